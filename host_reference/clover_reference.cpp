@@ -21,6 +21,7 @@ void cloverReference(sFloat *out, cFloat *clover, sFloat *in, int parity) {
   int N = nColor * nSpin / 2;
   int chiralBlock = N + 2*(N-1)*N/2;
 
+#pragma omp parallel for
   for (int i=0; i<Vh; i++) {
     std::complex<sFloat> *In = reinterpret_cast<std::complex<sFloat>*>(&in[i*nSpin*nColor*2]);
     std::complex<sFloat> *Out = reinterpret_cast<std::complex<sFloat>*>(&out[i*nSpin*nColor*2]);
@@ -64,28 +64,84 @@ static inline void dot(sFloat* res, gFloat* a, sFloat* b) {
   }
 }
 
-template <typename Float>
-static inline void su3Transpose(Float *res, Float *mat) {
-  for (int m = 0; m < 3; m++) {
-    for (int n = 0; n < 3; n++) {
-      res[m*(3*2) + n*(2) + 0] = + mat[n*(3*2) + m*(2) + 0];
-      res[m*(3*2) + n*(2) + 1] = - mat[n*(3*2) + m*(2) + 1];
-    }
-  }
-}
-
 
 template <typename sFloat, typename gFloat>
 static inline void su3Mul(sFloat *res, gFloat *mat, sFloat *vec) {
   for (int n = 0; n < 3; n++) dot(&res[n*(2)], &mat[n*(3*2)], vec);
 }
 
+// multiply by the hermitian conjugate of mat without forming it
 template <typename sFloat, typename gFloat>
 static inline void su3Tmul(sFloat *res, gFloat *mat, sFloat *vec) {
-  gFloat matT[3*3*2];
-  su3Transpose(matT, mat);
-  su3Mul(res, matT, vec);
+  for (int n = 0; n < 3; n++) {
+    sFloat re = 0, im = 0;
+    for (int m = 0; m < 3; m++) {
+      sFloat a_re = + mat[m*(3*2) + n*(2) + 0];
+      sFloat a_im = - mat[m*(3*2) + n*(2) + 1];
+      re += a_re * vec[2*m+0] - a_im * vec[2*m+1];
+      im += a_re * vec[2*m+1] + a_im * vec[2*m+0];
+    }
+    res[2*n+0] = re;
+    res[2*n+1] = im;
+  }
 }
+
+/**
+   @brief Apply mat to both color vectors of a half spinor, loading
+   each matrix element once.  The loops have a fixed trip count and
+   unit stride across the two spins so the compiler can vectorize
+   them.
+   @param[out] res Result half spinor (2 spins x 3 colors x complex)
+   @param[in] mat SU(3) matrix
+   @param[in] vec Input half spinor (2 spins x 3 colors x complex)
+ */
+template <typename sFloat, typename gFloat>
+static inline void su3MulHalf(sFloat *res, const gFloat *mat, const sFloat *vec) {
+  for (int n = 0; n < 3; n++) {
+    sFloat re[2] = {0, 0}, im[2] = {0, 0};
+    for (int m = 0; m < 3; m++) {
+      sFloat a_re = mat[n*(3*2) + m*(2) + 0];
+      sFloat a_im = mat[n*(3*2) + m*(2) + 1];
+#pragma omp simd
+      for (int s = 0; s < 2; s++) {
+        re[s] += a_re * vec[s*(3*2) + 2*m+0] - a_im * vec[s*(3*2) + 2*m+1];
+        im[s] += a_re * vec[s*(3*2) + 2*m+1] + a_im * vec[s*(3*2) + 2*m+0];
+      }
+    }
+    for (int s = 0; s < 2; s++) {
+      res[s*(3*2) + 2*n+0] = re[s];
+      res[s*(3*2) + 2*n+1] = im[s];
+    }
+  }
+}
+
+/**
+   @brief Apply the hermitian conjugate of mat to both color vectors
+   of a half spinor, without materializing the conjugate matrix
+   @param[out] res Result half spinor (2 spins x 3 colors x complex)
+   @param[in] mat SU(3) matrix
+   @param[in] vec Input half spinor (2 spins x 3 colors x complex)
+ */
+template <typename sFloat, typename gFloat>
+static inline void su3TmulHalf(sFloat *res, const gFloat *mat, const sFloat *vec) {
+  for (int n = 0; n < 3; n++) {
+    sFloat re[2] = {0, 0}, im[2] = {0, 0};
+    for (int m = 0; m < 3; m++) {
+      sFloat a_re = + mat[m*(3*2) + n*(2) + 0];
+      sFloat a_im = - mat[m*(3*2) + n*(2) + 1];
+#pragma omp simd
+      for (int s = 0; s < 2; s++) {
+        re[s] += a_re * vec[s*(3*2) + 2*m+0] - a_im * vec[s*(3*2) + 2*m+1];
+        im[s] += a_re * vec[s*(3*2) + 2*m+1] + a_im * vec[s*(3*2) + 2*m+0];
+      }
+    }
+    for (int s = 0; s < 2; s++) {
+      res[s*(3*2) + 2*n+0] = re[s];
+      res[s*(3*2) + 2*n+1] = im[s];
+    }
+  }
+}
+
 void verifyInversion(void *spinorOut, void *spinorIn, void *spinorCheck, QudaGaugeParam &gauge_param,
                      QudaInvertParam &inv_param, void **gauge, void *clover, void *clover_inv);
 
@@ -12,81 +12,195 @@
 
 #include <dslash_reference.h>
 #include <string.h>
+#include <vector>
 
 using namespace quda;
 
-static const double projector[8][4][4][2] = {
-  {
-    {{1,0}, {0,0}, {0,0}, {0,-1}},
-    {{0,0}, {1,0}, {0,-1}, {0,0}},
-    {{0,0}, {0,1}, {1,0}, {0,0}},
-    {{0,1}, {0,0}, {0,0}, {1,0}}
-  },
-  {
-    {{1,0}, {0,0}, {0,0}, {0,1}},
-    {{0,0}, {1,0}, {0,1}, {0,0}},
-    {{0,0}, {0,-1}, {1,0}, {0,0}},
-    {{0,-1}, {0,0}, {0,0}, {1,0}}
-  },
-  {
-    {{1,0}, {0,0}, {0,0}, {1,0}},
-    {{0,0}, {1,0}, {-1,0}, {0,0}},
-    {{0,0}, {-1,0}, {1,0}, {0,0}},
-    {{1,0}, {0,0}, {0,0}, {1,0}}
-  },
-  {
-    {{1,0}, {0,0}, {0,0}, {-1,0}},
-    {{0,0}, {1,0}, {1,0}, {0,0}},
-    {{0,0}, {1,0}, {1,0}, {0,0}},
-    {{-1,0}, {0,0}, {0,0}, {1,0}}
-  },
-  {
-    {{1,0}, {0,0}, {0,-1}, {0,0}},
-    {{0,0}, {1,0}, {0,0}, {0,1}},
-    {{0,1}, {0,0}, {1,0}, {0,0}},
-    {{0,0}, {0,-1}, {0,0}, {1,0}}
-  },
-  {
-    {{1,0}, {0,0}, {0,1}, {0,0}},
-    {{0,0}, {1,0}, {0,0}, {0,-1}},
-    {{0,-1}, {0,0}, {1,0}, {0,0}},
-    {{0,0}, {0,1}, {0,0}, {1,0}}
-  },
-  {
-    {{1,0}, {0,0}, {-1,0}, {0,0}},
-    {{0,0}, {1,0}, {0,0}, {-1,0}},
-    {{-1,0}, {0,0}, {1,0}, {0,0}},
-    {{0,0}, {-1,0}, {0,0}, {1,0}}
-  },
-  {
-    {{1,0}, {0,0}, {1,0}, {0,0}},
-    {{0,0}, {1,0}, {0,0}, {1,0}},
-    {{1,0}, {0,0}, {1,0}, {0,0}},
-    {{0,0}, {1,0}, {0,0}, {1,0}}
-  }
+// The spin projectors P = 1 -/+ gamma_mu (DeGrand-Rossi basis) have
+// rank two: the two upper spin rows are each the identity plus a
+// single off-diagonal element, and the two lower rows are unit
+// complex multiples of the upper ones.  We thus project to a
+// half spinor, apply the link to two color vectors instead of four,
+// and reconstruct the lower spin components.
+
+// upper rows: h[s] = psi[s] + c * psi[t], stored as {t, c_re, c_im}
+static const int projectorUpper[8][2][3] = {
+  {{3, 0, -1}, {2, 0, -1}},
+  {{3, 0, 1}, {2, 0, 1}},
+  {{3, 1, 0}, {2, -1, 0}},
+  {{3, -1, 0}, {2, 1, 0}},
+  {{2, 0, -1}, {3, 0, 1}},
+  {{2, 0, 1}, {3, 0, -1}},
+  {{2, -1, 0}, {3, -1, 0}},
+  {{2, 1, 0}, {3, 1, 0}}
 };
 
+// lower rows: psi'[2 + s] = c * psi'[h], stored as {h, c_re, c_im}
+static const int projectorLower[8][2][3] = {
+  {{1, 0, 1}, {0, 0, 1}},
+  {{1, 0, -1}, {0, 0, -1}},
+  {{1, -1, 0}, {0, 1, 0}},
+  {{1, 1, 0}, {0, -1, 0}},
+  {{0, 0, 1}, {1, 0, -1}},
+  {{0, 0, -1}, {1, 0, 1}},
+  {{0, -1, 0}, {1, -1, 0}},
+  {{0, 1, 0}, {1, 1, 0}}
+};
 
-// todo pass projector
+/**
+   @brief Apply the spin projector projIdx to a full spinor,
+   returning the two independent (upper) spin components
+   @param[out] res Half spinor (2 spins x 3 colors x complex)
+   @param[in] projIdx Projector index
+   @param[in] spinorIn Full spinor (4 spins x 3 colors x complex)
+ */
 template <typename Float>
-void multiplySpinorByDiracProjector(Float *res, int projIdx, Float *spinorIn) {
-  for (int i=0; i<4*3*2; i++) res[i] = 0.0;
-
-  for (int s = 0; s < 4; s++) {
-    for (int t = 0; t < 4; t++) {
-      Float projRe = projector[projIdx][s][t][0];
-      Float projIm = projector[projIdx][s][t][1];
-      
-      for (int m = 0; m < 3; m++) {
-	Float spinorRe = spinorIn[t*(3*2) + m*(2) + 0];
-	Float spinorIm = spinorIn[t*(3*2) + m*(2) + 1];
-	res[s*(3*2) + m*(2) + 0] += projRe*spinorRe - projIm*spinorIm;
-	res[s*(3*2) + m*(2) + 1] += projRe*spinorIm + projIm*spinorRe;
-      }
+static inline void projectSpinor(Float *res, int projIdx, const Float *spinorIn)
+{
+  for (int s = 0; s < 2; s++) {
+    const int t = projectorUpper[projIdx][s][0];
+    const Float cRe = projectorUpper[projIdx][s][1];
+    const Float cIm = projectorUpper[projIdx][s][2];
+    for (int m = 0; m < 3; m++) {
+      Float spinorRe = spinorIn[t * (3 * 2) + m * (2) + 0];
+      Float spinorIm = spinorIn[t * (3 * 2) + m * (2) + 1];
+      res[s * (3 * 2) + m * (2) + 0] = spinorIn[s * (3 * 2) + m * (2) + 0] + (cRe * spinorRe - cIm * spinorIm);
+      res[s * (3 * 2) + m * (2) + 1] = spinorIn[s * (3 * 2) + m * (2) + 1] + (cRe * spinorIm + cIm * spinorRe);
+    }
+  }
+}
+
+/**
+   @brief Reconstruct the full projected spinor from a half spinor
+   and accumulate it into res
+   @param[in,out] res Full spinor accumulator
+   @param[in] projIdx Projector index
+   @param[in] half Half spinor (2 spins x 3 colors x complex)
+ */
+template <typename Float>
+static inline void accumulateReconstruct(Float *res, int projIdx, const Float *half)
+{
+  for (int i = 0; i < 2 * 3 * 2; i++) res[i] += half[i];
+
+  for (int s = 0; s < 2; s++) {
+    const int h = projectorLower[projIdx][s][0];
+    const Float cRe = projectorLower[projIdx][s][1];
+    const Float cIm = projectorLower[projIdx][s][2];
+    for (int m = 0; m < 3; m++) {
+      Float halfRe = half[h * (3 * 2) + m * (2) + 0];
+      Float halfIm = half[h * (3 * 2) + m * (2) + 1];
+      res[(2 + s) * (3 * 2) + m * (2) + 0] += cRe * halfRe - cIm * halfIm;
+      res[(2 + s) * (3 * 2) + m * (2) + 1] += cRe * halfIm + cIm * halfRe;
     }
   }
 }
 
+/**
+   @brief Precomputed nearest-neighbor tables for the 4-d Wilson
+   stencil.  For each parity, site and direction we store where the
+   gauge link and neighboring spinor live (local field or ghost
+   buffer) and the site index within that buffer.  The tables are
+   built once per local lattice geometry and partitioning and reused
+   by every subsequent call to the reference dslash.
+ */
+struct WilsonNeighborTable {
+
+  // where a neighbor is to be found
+  enum Location : signed char { LOCAL = 0, FWD_GHOST = 1, BACK_GHOST = 2 };
+
+  struct Entry {
+    int gauge_idx;         // site index into the gauge field or ghost zone
+    int spinor_idx;        // site index into the spinor field or ghost zone
+    signed char gauge_loc;  // LOCAL or BACK_GHOST
+    signed char spinor_loc; // LOCAL, FWD_GHOST or BACK_GHOST
+  };
+
+  int X[4] = {};
+  bool partitioned[4] = {};
+  std::vector<Entry> entry[2]; // [parity][site * 8 + dir]
+
+  bool match(const int X_[4], const bool partitioned_[4]) const
+  {
+    for (int d = 0; d < 4; d++)
+      if (X[d] != X_[d] || partitioned[d] != partitioned_[d]) return false;
+    return entry[0].size() == 8 * static_cast<size_t>(Vh);
+  }
+
+  void build(const int X_[4], const bool partitioned_[4])
+  {
+    for (int d = 0; d < 4; d++) {
+      X[d] = X_[d];
+      partitioned[d] = partitioned_[d];
+    }
+
+    for (int parity = 0; parity < 2; parity++) {
+      entry[parity].resize(8 * Vh);
+
+#pragma omp parallel for
+      for (int i = 0; i < Vh; i++) {
+        int Y = fullLatticeIndex(i, parity);
+        int x[4] = {Y % X[0], (Y / X[0]) % X[1], (Y / (X[1] * X[0])) % X[2], Y / (X[2] * X[1] * X[0])};
+
+        for (int dir = 0; dir < 8; dir++) {
+          const int dim = dir / 2;
+          const bool fwd = dir % 2 == 0;
+          Entry &e = entry[parity][i * 8 + dir];
+
+          // checkerboarded index of this site within the face orthogonal to dim
+          int face_idx = 0;
+          for (int d = 3; d >= 0; d--)
+            if (d != dim) face_idx = face_idx * X[d] + x[d];
+          face_idx /= 2;
+
+          int y[4] = {x[0], x[1], x[2], x[3]};
+          y[dim] = (x[dim] + (fwd ? 1 : -1) + X[dim]) % X[dim];
+          const int nbr_idx = (((y[3] * X[2] + y[2]) * X[1] + y[1]) * X[0] + y[0]) / 2;
+          const bool boundary = fwd ? (x[dim] + 1 >= X[dim]) : (x[dim] - 1 < 0);
+
+          if (boundary && partitioned[dim]) {
+            e.spinor_loc = fwd ? FWD_GHOST : BACK_GHOST;
+            e.spinor_idx = face_idx;
+          } else {
+            e.spinor_loc = LOCAL;
+            e.spinor_idx = nbr_idx;
+          }
+
+          // forwards links live on this site, backwards links on the neighbor
+          if (fwd) {
+            e.gauge_loc = LOCAL;
+            e.gauge_idx = i;
+          } else if (boundary && partitioned[dim]) {
+            e.gauge_loc = BACK_GHOST;
+            e.gauge_idx = face_idx;
+          } else {
+            e.gauge_loc = LOCAL;
+            e.gauge_idx = nbr_idx;
+          }
+        }
+      }
+    }
+  }
+};
+
+/**
+   @brief Return the neighbor table matching the current local
+   lattice dimensions and partitioning, rebuilding it if either has
+   changed since the last call.
+ */
+static const WilsonNeighborTable &getNeighborTable()
+{
+  static WilsonNeighborTable table;
+  bool partitioned[4];
+  for (int d = 0; d < 4; d++) {
+#ifdef MULTI_GPU
+    partitioned[d] = comm_dim_partitioned(d);
+#else
+    partitioned[d] = false;
+#endif
+  }
+  if (!table.match(Z, partitioned)) table.build(Z, partitioned);
+  return table;
+}
 
 //
 // dslashReference()
@@ -97,87 +211,81 @@ void multiplySpinorByDiracProjector(Float *res, int projIdx, Float *spinorIn) {
 // if daggerBit is zero: perform ordinary dslash operator
 // if daggerBit is one:  perform hermitian conjugate of dslash
 //
-
-#ifndef MULTI_GPU
-
+// The ghost arguments are only dereferenced for partitioned
+// dimensions, and so may be null in the single-process case.
+//
 template <typename sFloat, typename gFloat>
-void dslashReference(sFloat *res, gFloat **gaugeFull, sFloat *spinorField, int oddBit, int daggerBit) {
-  for (int i = 0; i < Vh * my_spinor_site_size; i++) res[i] = 0.0;
+void dslashReference(sFloat *res, gFloat **gaugeFull, gFloat **ghostGauge, sFloat *spinorField, sFloat **fwdSpinor,
+                     sFloat **backSpinor, int oddBit, int daggerBit)
+{
+  const WilsonNeighborTable &table = getNeighborTable();
 
   gFloat *gaugeEven[4], *gaugeOdd[4];
-  for (int dir = 0; dir < 4; dir++) {  
+  gFloat *ghostGaugeEven[4] = {}, *ghostGaugeOdd[4] = {};
+  for (int dir = 0; dir < 4; dir++) {
     gaugeEven[dir] = gaugeFull[dir];
     gaugeOdd[dir] = gaugeFull[dir] + Vh * gauge_site_size;
-  }
-  
-  for (int i = 0; i < Vh; i++) {
-    for (int dir = 0; dir < 8; dir++) {
-      gFloat *gauge = gaugeLink(i, dir, oddBit, gaugeEven, gaugeOdd, 1);
-      sFloat *spinor = spinorNeighbor(i, dir, oddBit, spinorField, 1);
-      
-      sFloat projectedSpinor[4*3*2], gaugedSpinor[4*3*2];
-      int projIdx = 2*(dir/2)+(dir+daggerBit)%2;
-      multiplySpinorByDiracProjector(projectedSpinor, projIdx, spinor);
-      
-      for (int s = 0; s < 4; s++) {
-	if (dir % 2 == 0) su3Mul(&gaugedSpinor[s*(3*2)], gauge, &projectedSpinor[s*(3*2)]);
-	else su3Tmul(&gaugedSpinor[s*(3*2)], gauge, &projectedSpinor[s*(3*2)]);
-      }
-      
-      sum(&res[i*(4*3*2)], &res[i*(4*3*2)], gaugedSpinor, 4*3*2);
+
+    if (table.partitioned[dir]) {
+      ghostGaugeEven[dir] = ghostGauge[dir];
+      ghostGaugeOdd[dir] = ghostGauge[dir] + (faceVolume[dir] / 2) * gauge_site_size;
     }
   }
-}
 
-#else
+  // forwards links are taken from this parity, backwards links from the other
+  gFloat **gaugeThis = oddBit ? gaugeOdd : gaugeEven;
+  gFloat **gaugeOther = oddBit ? gaugeEven : gaugeOdd;
+  gFloat **ghostGaugeOther = oddBit ? ghostGaugeEven : ghostGaugeOdd;
+  const WilsonNeighborTable::Entry *entry = table.entry[oddBit].data();
 
-template <typename sFloat, typename gFloat>
-void dslashReference(sFloat *res, gFloat **gaugeFull,  gFloat **ghostGauge, sFloat *spinorField, 
-		     sFloat **fwdSpinor, sFloat **backSpinor, int oddBit, int daggerBit) {
-  for (int i = 0; i < Vh * my_spinor_site_size; i++) res[i] = 0.0;
-
-  gFloat *gaugeEven[4], *gaugeOdd[4];
-  gFloat *ghostGaugeEven[4], *ghostGaugeOdd[4];
-  for (int dir = 0; dir < 4; dir++) {  
-    gaugeEven[dir] = gaugeFull[dir];
-    gaugeOdd[dir] = gaugeFull[dir] + Vh * gauge_site_size;
-
-    ghostGaugeEven[dir] = ghostGauge[dir];
-    ghostGaugeOdd[dir] = ghostGauge[dir] + (faceVolume[dir] / 2) * gauge_site_size;
-  }
-  
+#pragma omp parallel for
   for (int i = 0; i < Vh; i++) {
+    sFloat accum[4 * 3 * 2] = {};
 
     for (int dir = 0; dir < 8; dir++) {
-      gFloat *gauge = gaugeLink_mg4dir(i, dir, oddBit, gaugeEven, gaugeOdd, ghostGaugeEven, ghostGaugeOdd, 1, 1);
-      sFloat *spinor = spinorNeighbor_mg4dir(i, dir, oddBit, spinorField, fwdSpinor, backSpinor, 1, 1);
+      const WilsonNeighborTable::Entry &e = entry[i * 8 + dir];
+      const int dim = dir / 2;
+
+      gFloat *gauge;
+      if (dir % 2 == 0)
+        gauge = &gaugeThis[dim][e.gauge_idx * gauge_site_size];
+      else if (e.gauge_loc == WilsonNeighborTable::BACK_GHOST)
+        gauge = &ghostGaugeOther[dim][e.gauge_idx * gauge_site_size];
+      else
+        gauge = &gaugeOther[dim][e.gauge_idx * gauge_site_size];
+
+      sFloat *spinor;
+      switch (e.spinor_loc) {
+      case WilsonNeighborTable::FWD_GHOST: spinor = &fwdSpinor[dim][e.spinor_idx * my_spinor_site_size]; break;
+      case WilsonNeighborTable::BACK_GHOST: spinor = &backSpinor[dim][e.spinor_idx * my_spinor_site_size]; break;
+      default: spinor = &spinorField[e.spinor_idx * my_spinor_site_size];
+      }
 
-      sFloat projectedSpinor[my_spinor_site_size], gaugedSpinor[my_spinor_site_size];
+      sFloat projectedSpinor[2*3*2], gaugedSpinor[2*3*2];
       int projIdx = 2*(dir/2)+(dir+daggerBit)%2;
-      multiplySpinorByDiracProjector(projectedSpinor, projIdx, spinor);
-      
-      for (int s = 0; s < 4; s++) {
-	if (dir % 2 == 0) su3Mul(&gaugedSpinor[s*(3*2)], gauge, &projectedSpinor[s*(3*2)]);
-	else su3Tmul(&gaugedSpinor[s*(3*2)], gauge, &projectedSpinor[s*(3*2)]);
-      }
-      
-      sum(&res[i*(4*3*2)], &res[i*(4*3*2)], gaugedSpinor, 4*3*2);
+      projectSpinor(projectedSpinor, projIdx, spinor);
+
+      if (dir % 2 == 0) su3MulHalf(gaugedSpinor, gauge, projectedSpinor);
+      else su3TmulHalf(gaugedSpinor, gauge, projectedSpinor);
+
+      accumulateReconstruct(accum, projIdx, gaugedSpinor);
     }
 
+    for (int j = 0; j < 4 * 3 * 2; j++) res[i * (4 * 3 * 2) + j] = accum[j];
   }
 }
 
-#endif
-
 // this actually applies the preconditioned dslash, e.g., D_ee^{-1} D_eo or D_oo^{-1} D_oe
 void wil_dslash(void *out, void **gauge, void *in, int oddBit, int daggerBit,
 		QudaPrecision precision, QudaGaugeParam &gauge_param) {
   
 #ifndef MULTI_GPU  
   if (precision == QUDA_DOUBLE_PRECISION)
-    dslashReference((double*)out, (double**)gauge, (double*)in, oddBit, daggerBit);
+    dslashReference((double *)out, (double **)gauge, (double **)nullptr, (double *)in, (double **)nullptr,
+                    (double **)nullptr, oddBit, daggerBit);
   else
-    dslashReference((float*)out, (float**)gauge, (float*)in, oddBit, daggerBit);
+    dslashReference((float *)out, (float **)gauge, (float **)nullptr, (float *)in, (float **)nullptr,
+                    (float **)nullptr, oddBit, daggerBit);
 #else
 
   GaugeFieldParam gauge_field_param(gauge, gauge_param);
@@ -247,6 +355,7 @@ void twistGamma5(sFloat *out, sFloat *in, const int dagger, const sFloat kappa,
 
   if (dagger) a *= -1.0;
 
+#pragma omp parallel for
   for(int i = 0; i < V; i++) {
     sFloat tmp[24];
     for(int s = 0; s < 4; s++)
@@ -425,7 +534,8 @@ void ndegTwistGamma5(sFloat *out1, sFloat *out2, sFloat *in1, sFloat *in2, const
   }
 
   if (dagger) a *= -1.0;
-  
+
+#pragma omp parallel for
   for(int i = 0; i < V; i++) {
     sFloat tmp1[24];
     sFloat tmp2[24];    
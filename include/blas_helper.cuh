@@ -1,5 +1,6 @@
 #pragma once
 
+#include <vector>
 #include <color_spinor_field.h>
 
 //#define QUAD_SUM
@@ -81,6 +82,34 @@ namespace quda
   }
 #endif
 
+  /**
+     Number of sites in each of the fixed-size blocks that the CPU
+     reductions are partitioned into.  The block partials are combined
+     with a fixed-shape tree, so the result only depends on this
+     value and never on the number of threads.
+  */
+  constexpr int reduce_cpu_block_size = 1024;
+
+  /**
+     @brief Sum a set of host partial sums using a pairwise tree whose
+     shape depends only on the number of partials.  Provided the
+     partials themselves are computed over a fixed partitioning of
+     the domain, the result is then bit-for-bit reproducible
+     regardless of how many threads computed them.
+     @param[in,out] partial The partial sums (overwritten)
+     @return The total sum
+  */
+  template <typename reduce_t> reduce_t tree_reduce(std::vector<reduce_t> &partial)
+  {
+    const int n = partial.size();
+    for (int stride = 1; stride < n; stride *= 2) {
+#pragma omp parallel for if (n / (2 * stride) > 64)
+      for (int i = 0; i < n - stride; i += 2 * stride) partial[i] += partial[i + stride];
+    }
+
+    return n > 0 ? partial[0] : reduce_t {};
+  }
+
   // Vector types used for AoS load-store on CPU
   template <> struct VectorType<double, 24> {
     using type = vector_type<double, 24>;
@@ -250,7 +279,12 @@ namespace quda
         for (int i = 0; i < n; i++) { v[i] = complex<real>(v_[2 * i + 0], v_[2 * i + 1]); }
       }
 
-      template <typename real, int n>
+      /**
+         @brief Save the vector v to site x
+         @tparam streaming Whether to use non-temporal stores, e.g.,
+         for write-only output streams on the host
+      */
+      template <bool streaming = false, typename real, int n>
       __device__ __host__ inline void save(const vector_type<complex<real>, n> &v, int x, int parity = 0)
       {
         constexpr int len = 2 * n; // real-valued length
@@ -279,7 +313,10 @@ namespace quda
 #pragma unroll
           for (int j = 0; j < N; j++) copy_scaled(reinterpret_cast<store_t *>(&vecTmp)[j], v_[i * N + j]);
           // second do vectorized copy into memory
-          vector_store(spinor, parity * cb_offset + x + stride * i, vecTmp);
+          if (streaming)
+            vector_store_streaming(spinor, parity * cb_offset + x + stride * i, vecTmp);
+          else
+            vector_store(spinor, parity * cb_offset + x + stride * i, vecTmp);
         }
       }
     };
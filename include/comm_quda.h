@@ -1,12 +1,24 @@
 #pragma once
 #include <cstdint>
 
+/**
+   With the threaded communications backend each rank is a thread
+   within a single process, so state that is private to a rank must be
+   thread local.
+*/
+#ifdef THREAD_COMMS
+#define QUDA_RANK_LOCAL thread_local
+#else
+#define QUDA_RANK_LOCAL
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
   typedef struct MsgHandle_s MsgHandle;
   typedef struct Topology_s Topology;
+  typedef struct ReduceHandle_s ReduceHandle;
 
   /* defined in quda.h; redefining here to avoid circular references */
   typedef int (*QudaCommsMap)(const int *coords, void *fdata);
@@ -156,6 +168,24 @@ extern "C" {
   */
   void comm_init_common(int ndim, const int *dims, QudaCommsMap rank_from_coords, void *map_data);
 
+  /**
+     @brief Node-aware rank map, which may be passed to
+     initCommsGridQuda (and is used by default if
+     QUDA_ENABLE_NODE_RANK_MAP=1).  Rather than assigning grid
+     coordinates lexicographically in rank order, the process grid is
+     factored into identical sub-blocks of the ranks that share a node
+     (as determined from their hostnames), choosing the sub-block
+     shape that minimizes the halo surface between nodes.  This
+     requires that all nodes have the same number of ranks, and falls
+     back to the lexicographic map if not.
+     @param[in] coords Grid coordinates
+     @param[in] fdata Optional pointer to the four local lattice
+     dimensions, used to weight each dimension by its face volume (if
+     null all faces are weighted equally)
+     @return Rank at the given coordinates
+  */
+  int comm_rank_from_coords_node_local(const int *coords, void *fdata);
+
   /**
      @return Rank id of this process
   */
@@ -176,6 +206,14 @@ extern "C" {
    */
   bool comm_deterministic_reduce();
 
+  /**
+     @return Whether the deterministic multi-process reductions use a
+     fixed binomial tree over rank order (QUDA_DETERMINISTIC_REDUCE=tree),
+     rather than gathering all contributions to every process and
+     summing them in sorted order (QUDA_DETERMINISTIC_REDUCE=1)
+   */
+  bool comm_deterministic_tree_reduce();
+
   /**
      @brief Gather all hostnames
      @param[out] hostname_recv_buf char array of length
@@ -304,14 +342,98 @@ extern "C" {
   void comm_allreduce_max_array(double* data, size_t size);
   void comm_allreduce_int(int* data);
   void comm_allreduce_xor(uint64_t *data);
+
+  /**
+     @brief Start a non-blocking sum reduction of an array over all
+     processes, performed in place.  The array must not be accessed
+     until the reduction has been completed with comm_allreduce_wait.
+     If deterministic reductions are enabled, the reduction is
+     completed before returning.
+     @param[in,out] data Local contribution on input, global sum once complete
+     @param[in] size Number of elements
+     @return Handle with which to test for and wait on completion
+  */
+  ReduceHandle *comm_allreduce_array_start(double *data, size_t size);
+
+  /**
+     @brief Query whether a non-blocking reduction has completed,
+     progressing it if not
+     @param[in] rh Handle returned by comm_allreduce_array_start
+     @return Non-zero if the reduction has completed
+  */
+  int comm_allreduce_test(ReduceHandle *rh);
+
+  /**
+     @brief Wait for a non-blocking reduction to complete and free
+     its handle
+     @param[in,out] rh Handle returned by comm_allreduce_array_start,
+     which is set to nullptr on return
+  */
+  void comm_allreduce_wait(ReduceHandle *&rh);
   void comm_broadcast(void *data, size_t nbytes);
+
+  /**
+     @brief Gather variable-length byte buffers from all ranks onto
+     rank 0, concatenated in rank order
+     @param[out] recv_buf Receive buffer (only referenced on rank 0)
+     @param[in] recv_bytes Number of bytes contributed by each rank
+     (only referenced on rank 0)
+     @param[in] send_buf Buffer contributed by this rank
+     @param[in] send_bytes Number of bytes contributed by this rank
+  */
+  void comm_gather_bytes(void *recv_buf, const size_t *recv_bytes, const void *send_buf, size_t send_bytes);
+
   void comm_barrier(void);
   void comm_abort(int status);
   void comm_abort_(int status);
 
+#ifdef THREAD_COMMS
+  /**
+     @brief Run a multi-rank job with the threaded communications
+     backend (comm_threads.cpp), in which each rank is a thread of
+     this process.  Each rank thread calls rank_main, which should
+     initialize the communications grid with initCommsGridQuda, whose
+     size must equal nranks.  Returns once all ranks have returned.
+     Only the comm_* API may be used by the rank threads, since the
+     state above the communications layer is shared between them.
+     @param[in] nranks Number of ranks to launch
+     @param[in] rank_main Function run by each rank
+     @param[in] arg Argument passed to rank_main
+  */
+  void comm_threads_launch(int nranks, void (*rank_main)(void *), void *arg);
+#endif
+
   void reduceMaxDouble(double &);
   void reduceDouble(double &);
   void reduceDoubleArray(double *, const int len);
+
+  /**
+     @brief Start a non-blocking global sum of an array, e.g., of
+     process-local reduction results computed with global reductions
+     disabled (commGlobalReductionSet(false)), so that the
+     communication may be overlapped with subsequent work.  Like
+     reduceDoubleArray, this is a no-op if global reductions are
+     disabled when it is called.
+     @param[in,out] sum Local sums on input, global sums once complete
+     @param[in] len Number of elements
+     @return Handle to pass to reduceWait (nullptr if there is nothing to wait for)
+  */
+  ReduceHandle *reduceDoubleArrayStart(double *sum, const int len);
+
+  /**
+     @brief Query whether a reduction started with
+     reduceDoubleArrayStart has completed
+     @param[in] rh Reduction handle
+     @return Whether the reduction has completed
+  */
+  bool reduceTest(ReduceHandle *rh);
+
+  /**
+     @brief Complete a reduction started with reduceDoubleArrayStart,
+     after which the sums may be read
+     @param[in,out] rh Reduction handle, which is set to nullptr on return
+  */
+  void reduceWait(ReduceHandle *&rh);
   int commDim(int);
   int commCoords(int);
   int commDimPartitioned(int dir);
@@ -264,6 +264,11 @@ namespace quda {
     */
     unsigned long long Flops() const { unsigned long long rtn = flops; flops = 0; return rtn; }
 
+    /**
+        @brief returns the flopcount without zeroing it
+    */
+    unsigned long long PeekFlops() const { return flops; }
+
     /**
        @brief returns preconditioning type
     */
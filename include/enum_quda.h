@@ -129,6 +129,7 @@ extern "C" {
     QUDA_CA_CGNE_INVERTER,
     QUDA_CA_CGNR_INVERTER,
     QUDA_CA_GCR_INVERTER,
+    QUDA_PIPELINED_CG_INVERTER,
     QUDA_INVALID_INVERTER = QUDA_INVALID_ENUM
   } QudaInverterType;
 
@@ -537,6 +537,17 @@ namespace quda {
      */
     void copy(const GaugeField &src);
 
+    /**
+       @brief Generic gauge field copy.  Overloaded variant that
+       includes profiling: when copying from a CPU field with the
+       reordering done on the host, the reordering is recorded under
+       QUDA_PROFILE_HOST_REORDER and the remainder of the copy under
+       QUDA_PROFILE_H2D.
+       @param[in] src Source from which we are copying
+       @param[in] profile Time profile to record the copy (may be nullptr)
+    */
+    void copy(const GaugeField &src, TimeProfile *profile);
+
     /**
        @brief Download into this field from a CPU field
        @param[in] cpu The CPU field source
@@ -602,7 +613,7 @@ namespace quda {
 
   class cpuGaugeField : public GaugeField {
 
-    friend void cudaGaugeField::copy(const GaugeField &cpu);
+    friend void cudaGaugeField::copy(const GaugeField &cpu, TimeProfile *profile);
     friend void cudaGaugeField::loadCPUField(const cpuGaugeField &cpu);
     friend void cudaGaugeField::saveCPUField(cpuGaugeField &cpu) const;
 
@@ -656,6 +667,17 @@ namespace quda {
     */
     void exchangeExtendedGhost(const int *R, TimeProfile &profile, bool no_comms_fill=false);
 
+    /**
+       @brief Reference variant of exchangeExtendedGhost that completes
+       the exchange in each dimension before extracting the next one,
+       rather than overlapping the extraction with the messages in
+       flight.  Retained for benchmarking and verification.
+       @param R The thickness of the extended region in each dimension
+       @param no_comms_fill Do local exchange to fill out the extended
+       region in non-partitioned dimensions
+    */
+    void exchangeExtendedGhostSerial(const int *R, bool no_comms_fill=false);
+
     /**
      * Generic gauge field copy
      * @param[in] src Source from which we are copying
@@ -776,8 +798,14 @@ namespace quda {
      @param dim The dimension in which we are packing/unpacking
      @param ghost The array where we want to pack/unpack the ghost zone into/from
      @param extract Whether we are extracting into ghost or injecting from ghost
+     @param split_dim If non-negative, only the part of the face whose
+     extended coordinate in dimension split_dim (which must be less
+     than dim) lies in [split_begin, split_end) is packed/unpacked
+     @param split_begin Start of the restricted range
+     @param split_end End of the restricted range
   */
-  void extractExtendedGaugeGhost(const GaugeField &u, int dim, const int *R, void **ghost, bool extract);
+  void extractExtendedGaugeGhost(const GaugeField &u, int dim, const int *R, void **ghost, bool extract,
+                                 int split_dim = -1, int split_begin = 0, int split_end = 0);
 
   /**
      Apply the staggered phase factor to the gauge field.
@@ -446,6 +446,24 @@ namespace quda {
 #endif
       }
 
+      /**
+         @brief Non-atomic variant of atomic_add, for use when the
+         caller owns the element being accumulated into, e.g., when
+         each thread is assigned a distinct coarse aggregate
+      */
+      template <typename theirFloat>
+      __device__ __host__ inline void add(int dim, int parity, int x_cb, int row, int col, const complex<theirFloat> &val) const {
+	auto &u_ = u[dim][ parity*cb_offset + (x_cb*nColor + row)*nColor + col];
+	if (fixed && !match<storeFloat,theirFloat>()) {
+	  complex<storeFloat> val_(round(scale * val.real()), round(scale * val.imag()));
+	  u_.x += val_.x;
+	  u_.y += val_.y;
+	} else {
+	  u_.x += static_cast<storeFloat>(val.x);
+	  u_.y += static_cast<storeFloat>(val.y);
+	}
+      }
+
       template <typename helper, typename reducer>
       __host__ double transform_reduce(QudaFieldLocation location, int dim, helper h, double init, reducer r) const
       {
@@ -591,6 +609,24 @@ namespace quda {
 #endif
       }
 
+      /**
+         @brief Non-atomic variant of atomic_add, for use when the
+         caller owns the element being accumulated into, e.g., when
+         each thread is assigned a distinct coarse aggregate
+      */
+      template <typename theirFloat>
+      __device__ __host__ inline void add(int dim, int parity, int x_cb, int row, int col, const complex<theirFloat> &val) const {
+	auto &u_ = u[(((parity*volumeCB+x_cb)*geometry + dim)*nColor + row)*nColor + col];
+	if (fixed && !match<storeFloat,theirFloat>()) {
+	  complex<storeFloat> val_(round(scale * val.real()), round(scale * val.imag()));
+	  u_.x += val_.x;
+	  u_.y += val_.y;
+	} else {
+	  u_.x += static_cast<storeFloat>(val.x);
+	  u_.y += static_cast<storeFloat>(val.y);
+	}
+      }
+
       template <typename helper, typename reducer>
       __host__ double transform_reduce(QudaFieldLocation location, int dim, helper h, double init, reducer r) const
       {
@@ -756,6 +792,24 @@ namespace quda {
 #endif
       }
 
+      /**
+         @brief Non-atomic variant of atomic_add, for use when the
+         caller owns the element being accumulated into, e.g., when
+         each thread is assigned a distinct coarse aggregate
+      */
+      template <typename theirFloat>
+      __device__ __host__ inline void add(int dim, int parity, int x_cb, int row, int col, const complex<theirFloat> &val) const {
+	auto &u_ = u[parity*offset_cb + dim*stride*nColor*nColor + (row*nColor+col)*stride + x_cb];
+	if (fixed && !match<storeFloat,theirFloat>()) {
+	  complex<storeFloat> val_(round(scale * val.real()), round(scale * val.imag()));
+	  u_.x += val_.x;
+	  u_.y += val_.y;
+	} else {
+	  u_.x += static_cast<storeFloat>(val.x);
+	  u_.y += static_cast<storeFloat>(val.y);
+	}
+      }
+
       template <typename helper, typename reducer>
       __host__ double transform_reduce(QudaFieldLocation location, int dim, helper h, double init, reducer r) const
       {
@@ -998,6 +1052,16 @@ namespace quda {
 	  accessor.atomic_add(d, parity, x, s_row*nColorCoarse + c_row, s_col*nColorCoarse + c_col, val);
 	}
 
+	/**
+	 * @brief Non-atomic accumulation into a coarse-link element;
+	 * only safe when no other thread updates the same site
+	 */
+        template <typename theirFloat>
+	__device__ __host__ inline void add(int d, int parity, int x, int s_row, int s_col,
+					    int c_row, int c_col, const complex<theirFloat> &val) {
+	  accessor.add(d, parity, x, s_row*nColorCoarse + c_row, s_col*nColorCoarse + c_col, val);
+	}
+
 	/** Returns the number of field colors */
 	__device__ __host__ inline int Ncolor() const { return nColor; }
 
@@ -454,6 +454,31 @@ namespace quda {
 
   };
 
+  /**
+     @brief Copy out the solver telemetry, oldest record first
+     @param[out] records Array the records are copied to
+     @param[in] n Length of records
+     @return The number of records copied
+  */
+  int getSolverTelemetry(QudaSolverTelemetryRecord *records, int n);
+
+  /**
+     @brief Write the solver telemetry to a binary file
+     @param[in] filename Path of the file to write
+  */
+  void saveSolverTelemetry(const char *filename);
+
+  /**
+     @brief Discard all solver telemetry recorded so far
+  */
+  void flushSolverTelemetry();
+
+  /**
+     @brief Discard all solver telemetry and restart the solve count,
+     called from initQuda
+  */
+  void resetSolverTelemetry();
+
   class Solver {
 
   protected:
@@ -471,6 +496,9 @@ namespace quda {
     std::vector<ColorSpinorField *> evecs;     /** Holds the eigenvectors. */
     std::vector<Complex> evals;                /** Holds the eigenvalues. */
 
+    int telemetry_solve;                            /** Index of the current solve in the telemetry */
+    timeline::clock::time_point telemetry_start;    /** When the current solve started */
+
   public:
     Solver(const DiracMatrix &mat, const DiracMatrix &matSloppy, const DiracMatrix &matPrecon,
            SolverParam &param, TimeProfile &profile);
@@ -543,6 +571,18 @@ namespace quda {
      */
     void PrintStats(const char *name, int k, double r2, double b2, double hq2);
 
+    /**
+       @brief Record an iteration or reliable update in the solver
+       telemetry (if enabled with QUDA_ENABLE_SOLVER_TELEMETRY).  This
+       only records values already on the host, so adds no
+       synchronization.  A record with k = 0 starts a new solve.
+       @param[in] k iteration count
+       @param[in] r2 L2 norm squared of the residual
+       @param[in] hq2 Heavy quark residual
+       @param[in] reliable_update Whether the residual was just recomputed in the precise precision
+     */
+    void RecordTelemetry(int k, double r2, double hq2, bool reliable_update = false);
+
     /**
        @brief Prints out the summary of the solver convergence
        (requires a verbosity of QUDA_SUMMARIZE).  Assumes
@@ -757,6 +797,44 @@ namespace quda {
     virtual bool hermitian() { return false; } /** CG3NR is for any system */
   };
 
+  /**
+     @brief Pipelined Conjugate-Gradient solver (Ghysels and
+     Vanroose).  The two inner products of each CG iteration are
+     fused into a single global reduction, which is started
+     asynchronously and overlapped with the matrix-vector product.
+     The additional recurrences make the iterated residual drift from
+     the true residual, so this is periodically replaced by the true
+     residual: whenever the iterated residual has dropped by a factor
+     of SolverParam::delta since the last replacement, and before
+     declaring convergence.
+   */
+  class PipelinedCG : public Solver
+  {
+
+  private:
+    // pointers to fields to avoid multiple creation overhead
+    ColorSpinorField *rp, *yp, *tmpp, *rSp, *xSp, *wSp, *pSp, *sSp, *zSp, *qSp, *tmpSp, *tmp2Sp;
+    bool init;
+
+    /**
+       @brief Replace the iterated residual with the true residual,
+       accumulating the sloppy solution into the full-precision
+       solution, and recompute the auxiliary vectors w = A r, s = A p
+       and z = A s consistently with it
+       @return The squared norm of the true residual
+    */
+    double replaceResidual(ColorSpinorField &x, ColorSpinorField &b);
+
+  public:
+    PipelinedCG(const DiracMatrix &mat, const DiracMatrix &matSloppy, const DiracMatrix &matPrecon,
+                SolverParam &param, TimeProfile &profile);
+    virtual ~PipelinedCG();
+
+    void operator()(ColorSpinorField &out, ColorSpinorField &in);
+
+    virtual bool hermitian() { return true; } /** Pipelined CG is only for Hermitian systems */
+  };
+
   class MPCG : public Solver {
     private:
       void computeMatrixPowers(cudaColorSpinorField out[], cudaColorSpinorField &in, int nvec);
@@ -71,30 +71,54 @@ namespace quda
 
     /**
        Generic blas kernel with four loads and up to four stores.
+
+       The (parity, site) range is statically partitioned across
+       n_threads threads, either contiguously (chunk == 0), matching
+       the first-touch placement of cpuColorSpinorField::zero(), or
+       round-robin in chunks of chunk sites.  Functors that are marked
+       as streaming do not read the fields they write, so these are
+       not loaded and are written with non-temporal stores.
     */
-    template <typename real, int n, typename Arg> void blasCPU(Arg arg)
+    template <typename real, int n, typename Arg> void blasCPU(Arg &arg, int n_threads, int chunk)
     {
       // n is real numbers per thread
       using vec = vector_type<complex<real>, n/2>;
+      constexpr bool streaming = decltype(arg.f)::streaming;
+      const int length = arg.nParity * arg.length;
 
-      arg.f.init();
-      for (int parity = 0; parity < arg.nParity; parity++) {
-        for (int i = 0; i < arg.length; i++) {
+#pragma omp parallel num_threads(n_threads)
+      {
+        auto f = arg.f;
+        f.init();
+
+        auto site = [&](int k) {
+          const int parity = k / arg.length;
+          const int i = k % arg.length;
           vec x, y, z, w, v;
-          arg.X.load(x, i, parity);
-          arg.Y.load(y, i, parity);
-          arg.Z.load(z, i, parity);
-          arg.W.load(w, i, parity);
-          arg.V.load(v, i, parity);
-
-          arg.f(x, y, z, w, v);
-
-          if (arg.f.write.X) arg.X.save(x, i, parity);
-          if (arg.f.write.Y) arg.Y.save(y, i, parity);
-          if (arg.f.write.Z) arg.Z.save(z, i, parity);
-          if (arg.f.write.W) arg.W.save(w, i, parity);
-          if (arg.f.write.V) arg.V.save(v, i, parity);
+          if (!(streaming && f.write.X)) arg.X.load(x, i, parity);
+          if (!(streaming && f.write.Y)) arg.Y.load(y, i, parity);
+          if (!(streaming && f.write.Z)) arg.Z.load(z, i, parity);
+          if (!(streaming && f.write.W)) arg.W.load(w, i, parity);
+          if (!(streaming && f.write.V)) arg.V.load(v, i, parity);
+
+          f(x, y, z, w, v);
+
+          if (f.write.X) arg.X.template save<streaming>(x, i, parity);
+          if (f.write.Y) arg.Y.template save<streaming>(y, i, parity);
+          if (f.write.Z) arg.Z.template save<streaming>(z, i, parity);
+          if (f.write.W) arg.W.template save<streaming>(w, i, parity);
+          if (f.write.V) arg.V.template save<streaming>(v, i, parity);
+        };
+
+        if (chunk == 0) {
+#pragma omp for schedule(static)
+          for (int k = 0; k < length; k++) site(k);
+        } else {
+#pragma omp for schedule(static, chunk)
+          for (int k = 0; k < length; k++) site(k);
         }
+
+        if (streaming) vector_store_fence();
       }
     }
 
@@ -102,6 +126,9 @@ namespace quda
        Base class from which all blas functors should derive
      */
     struct BlasFunctor {
+      //! whether the written fields are write only, allowing for streaming stores on the host
+      static constexpr bool streaming = false;
+
       //! pre-computation routine before the main loop
       virtual __device__ __host__ void init() { ; }
     };
@@ -111,6 +138,7 @@ namespace quda
     */
     template <typename real> struct axpbyz_ : public BlasFunctor {
       static constexpr write<0, 0, 0, 0, 1> write{ };
+      static constexpr bool streaming = true;
       const real a;
       const real b;
       axpbyz_(const real &a, const real &b, const real &c) : a(a), b(b) { ; }
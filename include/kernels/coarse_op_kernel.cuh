@@ -74,6 +74,12 @@ namespace quda {
     bool parity_flip;
 
     int_fastdiv aggregates_per_block; // number of aggregates per thread block
+
+    // On the CPU, assign each coarse aggregate to a single thread
+    // (using the coarse_to_fine map), so accumulation into Y and X
+    // needs no atomics.  Otherwise we parallelize over fine sites and
+    // scatter with atomics.
+    bool owner_computes;
     int_fastdiv grid_z; // this is the coarseColor grid that is wrapped into the x grid when coarse_color_wave is enabled
     int_fastdiv coarse_color_grid_z; // constant we ned to divide by
 
@@ -114,7 +120,7 @@ namespace quda {
         fineVolumeCB(V.VolumeCB()), coarseVolumeCB(X.VolumeCB()),
         fine_to_coarse(fine_to_coarse), coarse_to_fine(coarse_to_fine),
         bidirectional(bidirectional), shared_atomic(false), parity_flip(shared_atomic ? true : false),
-        aggregates_per_block(1), max_d(nullptr)
+        aggregates_per_block(1), owner_computes(false), max_d(nullptr)
     {
       if (V.GammaBasis() != QUDA_DEGRAND_ROSSI_GAMMA_BASIS)
 	errorQuda("Gamma basis %d not supported", V.GammaBasis());
@@ -774,7 +780,18 @@ namespace quda {
 #endif
   }
 
-  template <bool parity_flip, typename Float, QudaDirection dir, int coarseSpin, typename VUV, typename Arg>
+  /**
+     @brief Accumulate into a coarse-link element, atomically unless
+     the caller owns the coarse site being updated
+   */
+  template <bool atomic, typename Accessor, typename T>
+  inline __device__ __host__ void coarseAdd(Accessor &A, int d, int parity, int x_cb, int s_row, int s_col, int c_row, int c_col, const T &val)
+  {
+    if (atomic) A.atomicAdd(d, parity, x_cb, s_row, s_col, c_row, c_col, val);
+    else A.add(d, parity, x_cb, s_row, s_col, c_row, c_col, val);
+  }
+
+  template <bool parity_flip, typename Float, QudaDirection dir, int coarseSpin, bool atomic = true, typename VUV, typename Arg>
   inline __device__ __host__ void storeCoarseGlobalAtomic(VUV &vuv, bool isDiagonal, int coarse_x_cb, int coarse_parity, int i0, int j0, Arg &arg)
   {
     const int dim_index = arg.dim_index % arg.Y_atomic.geometry;
@@ -789,7 +806,7 @@ namespace quda {
           for (int i=0; i<tile.M; i++)
 #pragma unroll
             for (int j=0; j<tile.N; j++)
-              arg.Y_atomic.atomicAdd(dim_index,coarse_parity,coarse_x_cb,s_row,s_col,i0+i,j0+j,vuv[s_row*coarseSpin+s_col](i,j));
+              coarseAdd<atomic>(arg.Y_atomic, dim_index,coarse_parity,coarse_x_cb,s_row,s_col,i0+i,j0+j,vuv[s_row*coarseSpin+s_col](i,j));
         }
       }
     } else {
@@ -803,7 +820,7 @@ namespace quda {
             for (int i=0; i<tile.M; i++)
 #pragma unroll
               for (int j=0; j<tile.N; j++)
-                arg.X_atomic.atomicAdd(0,coarse_parity,coarse_x_cb,s_col,s_row,j0+j,i0+i,conj(vuv[s_row*coarseSpin+s_col](i,j)));
+                coarseAdd<atomic>(arg.X_atomic, 0,coarse_parity,coarse_x_cb,s_col,s_row,j0+j,i0+i,conj(vuv[s_row*coarseSpin+s_col](i,j)));
           }
         }
       } else {
@@ -815,7 +832,7 @@ namespace quda {
             for (int i=0; i<tile.M; i++)
 #pragma unroll
               for (int j=0; j<tile.N; j++)
-                arg.X_atomic.atomicAdd(0,coarse_parity,coarse_x_cb,s_row,s_col,i0+i,j0+j,vuv[s_row*coarseSpin+s_col](i,j));
+                coarseAdd<atomic>(arg.X_atomic, 0,coarse_parity,coarse_x_cb,s_row,s_col,i0+i,j0+j,vuv[s_row*coarseSpin+s_col](i,j));
           }
         }
       }
@@ -830,7 +847,7 @@ namespace quda {
             for (int i=0; i<tile.M; i++)
 #pragma unroll
               for (int j=0; j<tile.N; j++)
-                arg.X_atomic.atomicAdd(0,coarse_parity,coarse_x_cb,s_row,s_col,i0+i,j0+j,vuv[s_row*coarseSpin+s_col](i,j));
+                coarseAdd<atomic>(arg.X_atomic, 0,coarse_parity,coarse_x_cb,s_row,s_col,i0+i,j0+j,vuv[s_row*coarseSpin+s_col](i,j));
           }
         }
       }
@@ -840,7 +857,7 @@ namespace quda {
 
 
   template<bool shared_atomic, bool parity_flip, bool from_coarse, typename Float, int dim, QudaDirection dir,
-           int fineSpin, int coarseSpin, typename Arg, typename Gamma>
+           int fineSpin, int coarseSpin, bool atomic = true, typename Arg, typename Gamma>
   __device__ __host__ void computeVUV(Arg &arg, const Gamma &gamma, int parity, int x_cb, int i0, int j0, int parity_coarse_, int coarse_x_cb_)
   {
     constexpr int nDim = 4;
@@ -874,7 +891,7 @@ namespace quda {
     if (shared_atomic)
       storeCoarseSharedAtomic<parity_flip, Float, dir, coarseSpin>(vuv, isDiagonal, coarse_x_cb, coarse_parity, i0, j0, parity, arg);
     else
-      storeCoarseGlobalAtomic<parity_flip, Float, dir, coarseSpin>(vuv, isDiagonal, coarse_x_cb, coarse_parity, i0, j0, arg);
+      storeCoarseGlobalAtomic<parity_flip, Float, dir, coarseSpin, atomic>(vuv, isDiagonal, coarse_x_cb, coarse_parity, i0, j0, arg);
   }
 
   // compute indices for global-atomic kernel
@@ -929,6 +946,25 @@ namespace quda {
     constexpr bool shared_atomic = false; // not supported on CPU
     constexpr bool parity_flip = true;
 
+    if (arg.owner_computes) {
+      // every fine site of a given aggregate updates the same coarse
+      // site, so one thread per aggregate needs no atomics
+      const int aggregate_size_cb = arg.fineVolumeCB / (2 * arg.coarseVolumeCB);
+#pragma omp parallel for schedule(static)
+      for (int x_coarse = 0; x_coarse < 2 * arg.coarseVolumeCB; x_coarse++) {
+        for (int parity = 0; parity < 2; parity++) {
+          for (int k = 0; k < aggregate_size_cb; k++) {
+            const int x_cb = arg.coarse_to_fine[(x_coarse * 2 + parity) * aggregate_size_cb + k] - parity * arg.fineVolumeCB;
+            for (int ic = 0; ic < arg.vuvTile.m; ic += arg.vuvTile.M)
+              for (int jc = 0; jc < arg.vuvTile.n; jc += arg.vuvTile.N)
+                computeVUV<shared_atomic, parity_flip, from_coarse, Float, dim, dir, fineSpin, coarseSpin, false>(
+                  arg, gamma, parity, x_cb, ic, jc, 0, 0);
+          }
+        }
+      } // coarse volume
+      return;
+    }
+
     for (int parity=0; parity<2; parity++) {
 #pragma omp parallel for
       for (int x_cb=0; x_cb<arg.fineVolumeCB; x_cb++) { // Loop over fine volume
@@ -1011,7 +1047,7 @@ namespace quda {
     computeYreverse<Float,nSpin,nColor,Arg>(arg, parity, x_cb, ic_c, jc_c);
   }
 
-  template<bool from_coarse, typename Float, int fineSpin, int coarseSpin, int fineColor, int coarseColor, typename Arg>
+  template<bool from_coarse, typename Float, int fineSpin, int coarseSpin, int fineColor, int coarseColor, bool atomic = true, typename Arg>
   __device__ __host__ void computeCoarseClover(Arg &arg, int parity, int x_cb, int ic_c, int jc_c) {
 
     const int nDim = 4;
@@ -1065,7 +1101,7 @@ namespace quda {
 
     for (int si = 0; si < coarseSpin; si++) {
       for (int sj = 0; sj < coarseSpin; sj++) {
-        arg.X_atomic.atomicAdd(0,coarse_parity,coarse_x_cb,si,sj,ic_c,jc_c,X[si*coarseSpin+sj]);
+        coarseAdd<atomic>(arg.X_atomic, 0,coarse_parity,coarse_x_cb,si,sj,ic_c,jc_c,X[si*coarseSpin+sj]);
       }
     }
 
@@ -1073,6 +1109,22 @@ namespace quda {
 
   template <bool from_coarse, typename Float, int fineSpin, int coarseSpin, int fineColor, int coarseColor, typename Arg>
   void ComputeCoarseCloverCPU(Arg &arg) {
+    if (arg.owner_computes) {
+      const int aggregate_size_cb = arg.fineVolumeCB / (2 * arg.coarseVolumeCB);
+#pragma omp parallel for schedule(static)
+      for (int x_coarse = 0; x_coarse < 2 * arg.coarseVolumeCB; x_coarse++) {
+        for (int parity = 0; parity < 2; parity++) {
+          for (int k = 0; k < aggregate_size_cb; k++) {
+            const int x_cb = arg.coarse_to_fine[(x_coarse * 2 + parity) * aggregate_size_cb + k] - parity * arg.fineVolumeCB;
+            for (int jc_c = 0; jc_c < coarseColor; jc_c++)
+              for (int ic_c = 0; ic_c < coarseColor; ic_c++)
+                computeCoarseClover<from_coarse, Float, fineSpin, coarseSpin, fineColor, coarseColor, false>(arg, parity, x_cb, ic_c, jc_c);
+          }
+        }
+      } // coarse volume
+      return;
+    }
+
     for (int parity=0; parity<2; parity++) {
 #pragma omp parallel for
       for (int x_cb=0; x_cb<arg.fineVolumeCB; x_cb++) {
@@ -1,3 +1,5 @@
+#include <limits>
+#include <algorithm>
 #include <gauge_field_order.h>
 #include <quda_matrix.h>
 
@@ -26,65 +28,59 @@ namespace quda {
   };
 
   /**
-     Generic CPU gauge reordering and packing
+     Generic CPU gauge reordering and packing.  Threads are assigned
+     sites, and each site is converted for all directions in a single
+     sweep.  If check_nan is set, the input is checked for NaNs in the
+     same pass, and we error out on the first NaN found.
   */
-  template <typename FloatOut, typename FloatIn, int length, typename Arg>
+  template <typename FloatOut, typename FloatIn, int length, bool check_nan = false, typename Arg>
   void copyGauge(Arg &arg) {
     typedef typename mapper<FloatIn>::type RegTypeIn;
     typedef typename mapper<FloatOut>::type RegTypeOut;
     constexpr int nColor = Ncolor(length);
+    const int volumeCB = arg.volume / 2;
+    const int geometry = arg.geometry;
 
-    for (int parity=0; parity<2; parity++) {
+    // linear (parity, x, d, i) index of the first NaN found
+    long nan_index = std::numeric_limits<long>::max();
 
-      for (int d=0; d<arg.geometry; d++) {
-	for (int x=0; x<arg.volume/2; x++) {
+#pragma omp parallel for collapse(2) reduction(min : nan_index)
+    for (int parity=0; parity<2; parity++) {
+      for (int x=0; x<volumeCB; x++) {
+        for (int d=0; d<geometry; d++) {
+          const long site_index = ((static_cast<long>(parity) * volumeCB + x) * geometry + d) * (length / 2);
 #ifdef FINE_GRAINED_ACCESS
-	  for (int i=0; i<nColor; i++)
-	    for (int j=0; j<nColor; j++) {
-	      arg.out(d, parity, x, i, j) = arg.in(d, parity, x, i, j);
-	    }
+          for (int i=0; i<nColor; i++)
+            for (int j=0; j<nColor; j++) {
+              complex<RegTypeIn> u = arg.in(d, parity, x, i, j);
+              if (check_nan && (std::isnan(u.real()) || std::isnan(u.imag())))
+                nan_index = std::min(nan_index, site_index + i * nColor + j);
+              arg.out(d, parity, x, i, j) = u;
+            }
 #else
-	  Matrix<complex<RegTypeIn>, nColor> in;
-	  Matrix<complex<RegTypeOut>, nColor> out;
+          Matrix<complex<RegTypeIn>, nColor> in;
+          Matrix<complex<RegTypeOut>, nColor> out;
           in = arg.in(d, x, parity);
+          if (check_nan) {
+            for (int i=0; i<length/2; i++)
+              if (std::isnan(in(i).real()) || std::isnan(in(i).imag())) {
+                nan_index = std::min(nan_index, site_index + i);
+                break;
+              }
+          }
           out = in;
-	  arg.out(d, x, parity) = out;
+          arg.out(d, x, parity) = out;
 #endif
-	}
+        }
       }
-
     }
-  }
-
-  /**
-     Check whether the field contains Nans
-  */
-  template <typename Float, int length, typename Arg>
-  void checkNan(Arg &arg) {
-    typedef typename mapper<Float>::type RegType;
-    constexpr int nColor = Ncolor(length);
-
-    for (int parity=0; parity<2; parity++) {
-
-      for (int d=0; d<arg.geometry; d++) {
-	for (int x=0; x<arg.volume/2; x++) {
-#ifdef FINE_GRAINED_ACCESS
-	  for (int i=0; i<nColor; i++)
-	    for (int j=0; j<nColor; j++) {
-              complex<Float> u = arg.in(d, parity, x, i, j);
-	      if (isnan(u.real()))
-	        errorQuda("Nan detected at parity=%d, dir=%d, x=%d, i=%d", parity, d, x, 2*(i*Ncolor(length)+j));
-	      if (isnan(u.imag()))
-		errorQuda("Nan detected at parity=%d, dir=%d, x=%d, i=%d", parity, d, x, 2*(i*Ncolor(length)+j+1));
-            }
-#else
-	  Matrix<complex<RegType>, nColor> u = arg.in(d, x, parity);
-	  for (int i=0; i<length/2; i++)
-	    if (isnan(u(i).real()) || isnan(u(i).imag())) errorQuda("Nan detected at parity=%d, dir=%d, x=%d, i=%d", parity, d, x, i);
-#endif
-	}
-      }
 
+    if (check_nan && nan_index != std::numeric_limits<long>::max()) {
+      const int i = nan_index % (length / 2);
+      const int d = (nan_index / (length / 2)) % geometry;
+      const long site = nan_index / (length / 2) / geometry;
+      errorQuda("Nan detected at parity=%d, dir=%d, x=%d, i=%d", static_cast<int>(site / volumeCB), d,
+                static_cast<int>(site % volumeCB), i);
     }
   }
 
@@ -131,6 +127,7 @@ namespace quda {
     for (int parity=0; parity<2; parity++) {
 
       for (int d=0; d<arg.nDim; d++) {
+#pragma omp parallel for
         for (int x=0; x<arg.faceVolumeCB[d]; x++) {
 #ifdef FINE_GRAINED_ACCESS
           for (int i=0; i<nColor; i++)
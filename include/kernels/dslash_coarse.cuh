@@ -347,33 +347,163 @@ namespace quda {
 
   }
 
+  /**
+     Number of right-hand sides that the CPU coarse operator applies
+     each loaded link row to at once.
+   */
+  constexpr int coarse_dslash_cpu_src_block = 8;
+
+  /**
+     @brief Apply a single row of a coarse link matrix to a block of
+     right-hand sides: out[src][row] += sum_col link[col] * in[src][col].
+     The real and imaginary parts are accumulated separately so that
+     the complex dot product vectorizes.
+
+     @param out The output block
+     @param in The gathered input block
+     @param link The link matrix row
+     @param row The row index
+     @param n_src The number of right-hand sides in this block
+   */
+  template <typename Float, int N, int src_block>
+  inline void coarseRowCPU(complex<Float> out[src_block][N], const complex<Float> in[src_block][N],
+                           const complex<Float> link[N], int row, int n_src)
+  {
+    for (int src = 0; src < n_src; src++) {
+      Float re = 0.0, im = 0.0;
+#pragma omp simd reduction(+ : re, im)
+      for (int col = 0; col < N; col++) {
+        re += link[col].real() * in[src][col].real() - link[col].imag() * in[src][col].imag();
+        im += link[col].real() * in[src][col].imag() + link[col].imag() * in[src][col].real();
+      }
+      out[src][row] += complex<Float>(re, im);
+    }
+  }
+
+  /**
+     @brief Apply the coarse operator at a given site to a block of
+     right-hand sides.  Each row of every link matrix is loaded once
+     and applied to all the sources in the block.
+
+     @param arg The kernel arguments
+     @param x_cb The checkerboarded 4-d site index
+     @param parity The site parity
+     @param src_begin The first source in this block
+     @param n_src The number of sources in this block
+   */
+  template <typename Float, int nDim, int Ns, int Nc, int src_block, bool dslash, bool clover, bool dagger,
+            DslashType type, typename Arg>
+  inline void coarseDslashCPU(Arg &arg, int x_cb, int parity, int src_begin, int n_src)
+  {
+    constexpr int N = Ns * Nc;
+    const int their_spinor_parity = (arg.nParity == 2) ? 1 - parity : 0;
+    const int my_spinor_parity = (arg.nParity == 2) ? parity : 0;
+
+    complex<Float> out[src_block][N];
+    complex<Float> in[src_block][N];
+    complex<Float> link[N];
+    for (int src = 0; src < n_src; src++)
+      for (int i = 0; i < N; i++) out[src][i] = 0.0;
+
+    int coord[5];
+    getCoordsCB(coord, x_cb, arg.dim, arg.X0h, parity);
+    coord[4] = 0;
+
+    if (dslash) {
+      for (int d = 0; d < nDim; d++) {
+        // forward gather
+        const bool fwd_ghost = arg.commDim[d] && (coord[d] + arg.nFace >= arg.dim[d]);
+        if (fwd_ghost ? doHalo<type>() : doBulk<type>()) {
+          const int fwd_idx = linkIndexP1(coord, arg.dim, d);
+          for (int src = 0; src < n_src; src++) {
+            const int src_idx = src_begin + src;
+            int src_coord[5] = {coord[0], coord[1], coord[2], coord[3], src_idx};
+            const int ghost_idx = ghostFaceIndex<1, 5>(src_coord, arg.dim, d, arg.nFace);
+            for (int s_col = 0; s_col < Ns; s_col++)
+              for (int c_col = 0; c_col < Nc; c_col++)
+                in[src][s_col * Nc + c_col] = fwd_ghost ?
+                  arg.inA.Ghost(d, 1, their_spinor_parity, ghost_idx + src_idx * arg.volumeCB, s_col, c_col) :
+                  arg.inA(their_spinor_parity, fwd_idx + src_idx * arg.volumeCB, s_col, c_col);
+          }
+
+          for (int row = 0; row < N; row++) {
+            for (int col = 0; col < N; col++) link[col] = arg.Y(dagger ? d : d + 4, parity, x_cb, row, col);
+            coarseRowCPU<Float, N, src_block>(out, in, link, row, n_src);
+          }
+        }
+
+        // backward gather
+        const bool back_ghost = arg.commDim[d] && (coord[d] - arg.nFace < 0);
+        if (back_ghost ? doHalo<type>() : doBulk<type>()) {
+          const int back_idx = linkIndexM1(coord, arg.dim, d);
+          const int gauge_ghost_idx = ghostFaceIndex<0, 5>(coord, arg.dim, d, arg.nFace);
+          for (int src = 0; src < n_src; src++) {
+            const int src_idx = src_begin + src;
+            int src_coord[5] = {coord[0], coord[1], coord[2], coord[3], src_idx};
+            const int ghost_idx = ghostFaceIndex<0, 5>(src_coord, arg.dim, d, arg.nFace);
+            for (int s_col = 0; s_col < Ns; s_col++)
+              for (int c_col = 0; c_col < Nc; c_col++)
+                in[src][s_col * Nc + c_col] = back_ghost ?
+                  arg.inA.Ghost(d, 0, their_spinor_parity, ghost_idx + src_idx * arg.volumeCB, s_col, c_col) :
+                  arg.inA(their_spinor_parity, back_idx + src_idx * arg.volumeCB, s_col, c_col);
+          }
+
+          for (int row = 0; row < N; row++) {
+            for (int col = 0; col < N; col++)
+              link[col] = conj(back_ghost ? arg.Y.Ghost(dagger ? d + 4 : d, 1 - parity, gauge_ghost_idx, col, row) :
+                                            arg.Y(dagger ? d + 4 : d, 1 - parity, back_idx, col, row));
+            coarseRowCPU<Float, N, src_block>(out, in, link, row, n_src);
+          }
+        }
+      }
+
+      for (int src = 0; src < n_src; src++)
+        for (int i = 0; i < N; i++) out[src][i] *= -arg.kappa;
+    }
+
+    if (doBulk<type>() && clover) {
+      for (int src = 0; src < n_src; src++)
+        for (int s_col = 0; s_col < Ns; s_col++)
+          for (int c_col = 0; c_col < Nc; c_col++)
+            in[src][s_col * Nc + c_col] = arg.inB(my_spinor_parity, x_cb + (src_begin + src) * arg.volumeCB, s_col, c_col);
+
+      for (int row = 0; row < N; row++) {
+        for (int col = 0; col < N; col++)
+          link[col] = dagger ? conj(arg.X(0, parity, x_cb, col, row)) : arg.X(0, parity, x_cb, row, col);
+        coarseRowCPU<Float, N, src_block>(out, in, link, row, n_src);
+      }
+    }
+
+    for (int src = 0; src < n_src; src++) {
+      for (int s = 0; s < Ns; s++) {
+        for (int c = 0; c < Nc; c++) {
+          // if not halo we just store, else we accumulate
+          if (doBulk<type>()) arg.out(my_spinor_parity, x_cb + (src_begin + src) * arg.volumeCB, s, c) = out[src][s * Nc + c];
+          else arg.out(my_spinor_parity, x_cb + (src_begin + src) * arg.volumeCB, s, c) += out[src][s * Nc + c];
+        }
+      }
+    }
+  }
+
   // CPU kernel for applying the coarse Dslash to a vector
   template <typename Float, int nDim, int Ns, int Nc, int Mc, bool dslash, bool clover, bool dagger, DslashType type, typename Arg>
   void coarseDslash(Arg arg)
   {
-    // the fine-grain parameters mean nothing for CPU variant
-    const int color_stride = 1;
-    const int color_offset = 0;
-    const int dim_thread_split = 1;
-    const int dir = 0;
-    const int dim = 0;
-
-    for (int parity= 0; parity < arg.nParity; parity++) {
+    constexpr int src_block = coarse_dslash_cpu_src_block;
+    const int n_src = arg.dim[4];
+
+    // the right-hand sides are innermost so that each link is loaded once for all sources
+#pragma omp parallel for schedule(static)
+    for (int site = 0; site < arg.nParity * arg.volumeCB; site++) {
       // for full fields then set parity from loop else use arg setting
-      parity = (arg.nParity == 2) ? parity : arg.parity;
-
-      for (int src_idx = 0; src_idx < arg.dim[4]; src_idx++) {
-	//#pragma omp parallel for
-	for(int x_cb = 0; x_cb < arg.volumeCB; x_cb++) { // 4-d volume
-	  for (int s=0; s<2; s++) {
-	    for (int color_block=0; color_block<Nc; color_block+=Mc) { // Mc=Nc means all colors in a thread
-	      coarseDslash<Float,nDim,Ns,Nc,Mc,color_stride,dim_thread_split,dslash,clover,dagger,type,dir,dim>(arg, x_cb, src_idx, parity, s, color_block, color_offset);
-	    }
-	  }
-	} // 4-d volumeCB
-      } // src index
-    } // parity
+      const int parity = (arg.nParity == 2) ? site / arg.volumeCB : arg.parity;
+      const int x_cb = site % arg.volumeCB;
 
+      for (int src_begin = 0; src_begin < n_src; src_begin += src_block) {
+        coarseDslashCPU<Float, nDim, Ns, Nc, src_block, dslash, clover, dagger, type>(
+          arg, x_cb, parity, src_begin, std::min(src_block, n_src - src_begin));
+      }
+    }
   }
 
   // GPU Kernel for applying the coarse Dslash to a vector
@@ -134,6 +134,45 @@ namespace quda
       }
     }
 
+    /**
+       @brief Generic multi-blas kernel for host fields.  Sites are
+       partitioned across threads, and at each site all NXZ input
+       vectors are loaded once and the full coefficient matrix is
+       applied to every one of the NYW output vectors, so that the
+       update is a single pass over memory.
+       @param[in,out] arg Argument struct with required meta data
+       (input/output fields, functor, etc.)
+       @param[in] nParity Number of parities of the fields
+    */
+    template <typename real, int n, int NXZ, typename Arg> void multiBlasCPU(Arg &arg, int nParity)
+    {
+      // n is real numbers per thread
+      using vec = vector_type<complex<real>, n/2>;
+
+#pragma omp parallel for schedule(static)
+      for (int s = 0; s < nParity * arg.length; s++) {
+        const int parity = s / arg.length;
+        const int idx = s % arg.length;
+
+        vec x[NXZ], z[NXZ];
+        for (int l = 0; l < NXZ; l++) {
+          arg.X[l].load(x[l], idx, parity);
+          arg.Z[l].load(z[l], idx, parity);
+        }
+
+        for (int k = 0; k < arg.NYW; k++) {
+          vec y, w;
+          arg.Y[k].load(y, idx, parity);
+          arg.W[k].load(w, idx, parity);
+
+          for (int l = 0; l < NXZ; l++) arg.f(x[l], y, z[l], w, k, l);
+
+          if (arg.f.write.Y) arg.Y[k].save(y, idx, parity);
+          if (arg.f.write.W) arg.W[k].save(w, idx, parity);
+        }
+      }
+    }
+
     template <typename coeff_t_, bool multi_1d_ = false>
     struct MultiBlasFunctor {
       using coeff_t = coeff_t_;
@@ -104,6 +104,74 @@ namespace quda
 #endif
     } // multiReduceKernel
 
+    /**
+       @brief Generic multi-reduction kernel for host fields.  As with
+       reduceCPU, sites are split into fixed-size blocks whose partial
+       sums are combined with a fixed-shape tree, so the result does
+       not depend on the number of threads.  Within a site all NXZ
+       input vectors are loaded once and reused for all NYW rows.
+       @param[out] result Array of NXZ * NYW reductions, stored as
+       result[l * NYW + k]
+       @param[in,out] arg Argument struct with required meta data
+       (input/output fields, reducer, etc.)
+       @param[in] nParity Number of parities of the fields
+    */
+    template <typename real, int n, int NXZ, typename Arg, typename T>
+    void multiReduceCPU(T result[], Arg &arg, int nParity)
+    {
+      // n is real numbers per thread
+      using vec = vector_type<complex<real>, n/2>;
+
+      using reduce_t = typename Arg::Reducer::reduce_t;
+      const int blocks_per_parity = (arg.length + reduce_cpu_block_size - 1) / reduce_cpu_block_size;
+      const int n_block = nParity * blocks_per_parity;
+      const int n_reduce = NXZ * arg.NYW;
+      std::vector<reduce_t> partial(n_block * n_reduce);
+
+#pragma omp parallel for schedule(static)
+      for (int block = 0; block < n_block; block++) {
+        const int parity = block / blocks_per_parity;
+        const int begin = (block % blocks_per_parity) * reduce_cpu_block_size;
+        const int end = std::min(begin + reduce_cpu_block_size, arg.length);
+
+        // the reducer may carry state between pre and post, so each thread needs its own copy
+        auto r = arg.r;
+        std::vector<reduce_t> block_sum(n_reduce); // value-initialized to zero
+
+        for (int i = begin; i < end; i++) {
+          vec x[NXZ], z[NXZ];
+          for (int l = 0; l < NXZ; l++) {
+            arg.X[l].load(x[l], i, parity);
+            arg.Z[l].load(z[l], i, parity);
+          }
+
+          for (int k = 0; k < arg.NYW; k++) {
+            vec y, w;
+            arg.Y[k].load(y, i, parity);
+            arg.W[k].load(w, i, parity);
+
+            for (int l = 0; l < NXZ; l++) {
+              reduce_t &sum = block_sum[l * arg.NYW + k];
+              r.pre();
+              r(sum, x[l], y, z[l], w, k, l);
+              r.post(sum);
+            }
+
+            if (r.write.Y) arg.Y[k].save(y, i, parity);
+            if (r.write.W) arg.W[k].save(w, i, parity);
+          }
+        }
+
+        std::copy(block_sum.begin(), block_sum.end(), partial.begin() + block * n_reduce);
+      }
+
+      std::vector<reduce_t> sum(n_block);
+      for (int kl = 0; kl < n_reduce; kl++) {
+        for (int block = 0; block < n_block; block++) sum[block] = partial[block * n_reduce + kl];
+        result[kl] = static_cast<T>(tree_reduce(sum));
+      }
+    }
+
     /**
        Base class from which all reduction functors should derive.
 
@@ -84,11 +84,21 @@ namespace quda
       using vec = vector_type<complex<real>, n/2>;
 
       using reduce_t = typename Arg::Reducer::reduce_t;
-      reduce_t sum;
-      ::quda::zero(sum);
+      const int blocks_per_parity = (arg.length + reduce_cpu_block_size - 1) / reduce_cpu_block_size;
+      std::vector<reduce_t> partial(arg.nParity * blocks_per_parity);
+
+#pragma omp parallel for schedule(static)
+      for (int block = 0; block < arg.nParity * blocks_per_parity; block++) {
+        const int parity = block / blocks_per_parity;
+        const int begin = (block % blocks_per_parity) * reduce_cpu_block_size;
+        const int end = std::min(begin + reduce_cpu_block_size, arg.length);
 
-      for (int parity = 0; parity < arg.nParity; parity++) {
-        for (int i = 0; i < arg.length; i++) {
+        // the reducer may carry state between pre and post, so each thread needs its own copy
+        auto r = arg.r;
+        reduce_t sum;
+        ::quda::zero(sum);
+
+        for (int i = begin; i < end; i++) {
           vec x, y, z, w, v;
           arg.X.load(x, i, parity);
           arg.Y.load(y, i, parity);
@@ -96,19 +106,21 @@ namespace quda
           arg.W.load(w, i, parity);
           arg.V.load(v, i, parity);
 
-          arg.r.pre();
-          arg.r(sum, x, y, z, w, v);
-          arg.r.post(sum);
+          r.pre();
+          r(sum, x, y, z, w, v);
+          r.post(sum);
 
-          if (arg.r.write.X) arg.X.save(x, i, parity);
-          if (arg.r.write.Y) arg.Y.save(y, i, parity);
-          if (arg.r.write.Z) arg.Z.save(z, i, parity);
-          if (arg.r.write.W) arg.W.save(w, i, parity);
-          if (arg.r.write.V) arg.V.save(v, i, parity);
+          if (r.write.X) arg.X.save(x, i, parity);
+          if (r.write.Y) arg.Y.save(y, i, parity);
+          if (r.write.Z) arg.Z.save(z, i, parity);
+          if (r.write.W) arg.W.save(w, i, parity);
+          if (r.write.V) arg.V.save(v, i, parity);
         }
+
+        partial[block] = sum;
       }
 
-      return sum;
+      return tree_reduce(partial);
     }
 
     /**
@@ -1,5 +1,26 @@
 #pragma once
 
+/**
+   Native readers and writers of SciDAC single-file LIME lattice
+   files, which do not depend on QIO and produce files interchangeable
+   with those written by QIO.  Each rank reads or writes its own
+   sub-volume of the file directly.  These are used by the functions
+   below when QUDA is built without QIO, or when QUDA_ENABLE_NATIVE_IO
+   is set.
+*/
+void read_gauge_field_lime(const char *filename, void *gauge[], QudaPrecision prec, const int *X);
+void write_gauge_field_lime(const char *filename, void *gauge[], QudaPrecision prec, const int *X);
+void read_spinor_field_lime(const char *filename, void *V[], QudaPrecision precision, const int *X,
+                            QudaSiteSubset subset, QudaParity parity, int nColor, int nSpin, int Nvec);
+void write_spinor_field_lime(const char *filename, void *V[], QudaPrecision precision, const int *X,
+                             QudaSiteSubset subset, QudaParity parity, int nColor, int nSpin, int Nvec);
+
+/**
+   @brief Whether the native LIME reader and writer are used in place
+   of QIO, which is always the case when QUDA is built without QIO
+*/
+bool native_io_enabled();
+
 #ifdef HAVE_QIO
 void read_gauge_field(const char *filename, void *gauge[], QudaPrecision prec, const int *X,
 		      int argc, char *argv[]);
@@ -12,28 +33,24 @@ void write_spinor_field(const char *filename, void *V[], QudaPrecision precision
 inline void read_gauge_field(const char *filename, void *gauge[], QudaPrecision prec, const int *X, int argc,
                              char *argv[])
 {
-  printf("QIO support has not been enabled\n");
-  exit(-1);
+  read_gauge_field_lime(filename, gauge, prec, X);
 }
 inline void write_gauge_field(const char *filename, void *gauge[], QudaPrecision prec, const int *X, int argc,
                               char *argv[])
 {
-  printf("QIO support has not been enabled\n");
-  exit(-1);
+  write_gauge_field_lime(filename, gauge, prec, X);
 }
 inline void read_spinor_field(const char *filename, void *V[], QudaPrecision precision, const int *X,
                               QudaSiteSubset subset, QudaParity parity, int nColor, int nSpin, int Nvec, int argc,
                               char *argv[])
 {
-  printf("QIO support has not been enabled\n");
-  exit(-1);
+  read_spinor_field_lime(filename, V, precision, X, subset, parity, nColor, nSpin, Nvec);
 }
 inline void write_spinor_field(const char *filename, void *V[], QudaPrecision precision, const int *X,
                                QudaSiteSubset subset, QudaParity parity, int nColor, int nSpin, int Nvec, int argc,
                                char *argv[])
 {
-  printf("QIO support has not been enabled\n");
-  exit(-1);
+  write_spinor_field_lime(filename, V, precision, X, subset, parity, nColor, nSpin, Nvec);
 }
 
 #endif
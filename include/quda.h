@@ -709,6 +709,23 @@ extern "C" {
     void *qcharge_density; /**< Pointer to host array of length volume where the q-charge density will be copied */
   } QudaGaugeObservableParam;
 
+  /**
+   * Per-iteration record of solver convergence, as recorded when
+   * QUDA_ENABLE_SOLVER_TELEMETRY is set (see getSolverTelemetryQuda)
+   */
+  typedef struct QudaSolverTelemetryRecord_s {
+    int solve;                 /**< Index of the solve (counted from initQuda) this record belongs to */
+    int iter;                  /**< Iteration count */
+    QudaInverterType inv_type; /**< Which solver recorded this */
+    QudaBoolean reliable_update; /**< Whether this is a reliable update (the residual recomputed in the precise precision) */
+    QudaPrecision precision;   /**< The precision in use: sloppy for iterations, precise for reliable updates */
+    QudaBoolean preconditioner; /**< Whether the solver is acting as a preconditioner for another solver */
+    double r2;                 /**< L2 norm squared of the residual */
+    double hq2;                /**< Heavy-quark residual (if computed, else zero) */
+    double time;               /**< Time in seconds since the start of the solve */
+    double flops;              /**< Flops performed so far in this solve */
+  } QudaSolverTelemetryRecord;
+
   /*
    * Interface functions, found in interface_quda.cpp
    */
@@ -1395,6 +1412,31 @@ extern "C" {
    */
   void flushChronoQuda(int index);
 
+  /**
+   * @brief Copy out the solver telemetry, oldest record first.  The
+   * telemetry is held in a bounded buffer (of
+   * QUDA_SOLVER_TELEMETRY_SIZE records), so only the most recent
+   * records are retained.
+   * @param[out] records Array the records are copied to
+   * @param[in] n Length of records
+   * @return The number of records copied
+   */
+  int getSolverTelemetryQuda(QudaSolverTelemetryRecord *records, int n);
+
+  /**
+   * @brief Write the solver telemetry to a binary file: a header
+   * (the magic "QUDASTEL", then the uint32 format version, record
+   * size, number of records and number of records dropped) followed
+   * by the records, oldest first
+   * @param[in] filename Path of the file to write
+   */
+  void saveSolverTelemetryQuda(const char *filename);
+
+  /**
+   * @brief Discard all solver telemetry recorded so far
+   */
+  void flushSolverTelemetryQuda();
+
 
   /**
   * Open/Close MAGMA library
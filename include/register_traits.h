@@ -13,6 +13,13 @@
 #include <complex_quda.h>
 #include <inline_ptx.h>
 
+#if !defined(__CUDA_ARCH__) && defined(__SSE2__) && defined(__x86_64__)
+#define HOST_STREAMING_STORE
+#include <emmintrin.h>
+#include <cstdint>
+#include <cstring>
+#endif
+
 namespace quda {
 
   /*
@@ -594,6 +601,51 @@ namespace quda {
 #endif
   }
 
+  /**
+     @brief Store a vector using non-temporal (cache-bypassing) stores.
+     On the device regular vector stores are already streaming, so this
+     is only distinct on the host, where it is used for output streams
+     that are written but never read by a kernel.  Where the host does
+     not support non-temporal stores this is a regular store.
+   */
+  template <typename VectorType>
+    __device__ __host__ inline void vector_store_streaming(void *ptr, int idx, const VectorType &value) {
+#ifdef HOST_STREAMING_STORE
+    char *dst = reinterpret_cast<char *>(reinterpret_cast<VectorType *>(ptr) + idx);
+    const char *src = reinterpret_cast<const char *>(&value);
+    if (sizeof(VectorType) % sizeof(long long) == 0 && reinterpret_cast<uintptr_t>(dst) % sizeof(long long) == 0) {
+      for (unsigned int i = 0; i < sizeof(VectorType); i += sizeof(long long)) {
+        long long word;
+        memcpy(&word, src + i, sizeof(long long));
+        _mm_stream_si64(reinterpret_cast<long long *>(dst + i), word);
+      }
+    } else if (sizeof(VectorType) % sizeof(int) == 0 && reinterpret_cast<uintptr_t>(dst) % sizeof(int) == 0) {
+      for (unsigned int i = 0; i < sizeof(VectorType); i += sizeof(int)) {
+        int word;
+        memcpy(&word, src + i, sizeof(int));
+        _mm_stream_si32(reinterpret_cast<int *>(dst + i), word);
+      }
+    } else {
+      vector_store(ptr, idx, value);
+    }
+#else
+    vector_store(ptr, idx, value);
+#endif
+  }
+
+  /**
+     @brief Order any preceding host non-temporal stores issued by this
+     thread before subsequent stores.  Each thread that issues
+     vector_store_streaming must call this before its results are
+     consumed by another thread.
+   */
+  __device__ __host__ inline void vector_store_fence()
+  {
+#ifdef HOST_STREAMING_STORE
+    _mm_sfence();
+#endif
+  }
+
   template<bool large_alloc> struct AllocType { };
   template<> struct AllocType<true> { typedef size_t type; };
   template<> struct AllocType<false> { typedef int type; };
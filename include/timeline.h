@@ -0,0 +1,98 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+
+/**
+   @file timeline.h
+
+   @brief Low-overhead recording of a per-rank timeline of host-side
+   events (TimeProfile regions, kernel launches, tuning and
+   communication), which is exported in the Chrome trace event
+   format, for viewing with chrome://tracing or Perfetto.  Recording
+   is enabled by setting QUDA_ENABLE_TIMELINE=1, and the timeline is
+   written by endQuda to timeline_<rank>.json in QUDA_RESOURCE_PATH
+   (or the current directory if this is not set).
+*/
+
+namespace quda
+{
+
+  namespace timeline
+  {
+
+    using clock = std::chrono::steady_clock;
+
+    /**
+       @return Whether timeline recording is enabled
+    */
+    bool enabled();
+
+    /**
+       @brief Record a completed region.  Regions recorded by the same
+       thread are displayed nested by their time extent.  This is
+       thread safe, and lock free after the first event recorded by a
+       given thread.
+       @param[in] cat Event category, e.g., "profile", "comms"
+       @param[in] name Event name
+       @param[in] begin Time the region started
+       @param[in] end Time the region ended
+       @param[in] args Optional JSON members (as generated by arg()) to attach to the event
+    */
+    void record(const char *cat, const std::string &name, clock::time_point begin, clock::time_point end,
+                const std::string &args = "");
+
+    /**
+       @brief Record an instantaneous event, e.g., an asynchronous kernel launch
+       @param[in] cat Event category
+       @param[in] name Event name
+       @param[in] args Optional JSON members (as generated by arg()) to attach to the event
+    */
+    void instant(const char *cat, const std::string &name, const std::string &args = "");
+
+    /**
+       @return A JSON object member "key":"value", with the value escaped
+    */
+    std::string arg(const char *key, const std::string &value);
+
+    /**
+       @return A JSON object member "key":value
+    */
+    std::string arg(const char *key, long value);
+
+    /**
+       @brief Write the recorded timeline to timeline_<rank>.json and
+       discard the recorded events.  Must not be called concurrently
+       with recording.
+       @param[in] rank The rank of this process, used to label the timeline
+    */
+    void save(int rank);
+
+    /**
+       @brief RAII helper that records the region spanned by its lifetime
+    */
+    class Scope
+    {
+      const char *cat;
+      const char *name;
+      bool active;
+      clock::time_point begin;
+
+    public:
+      Scope(const char *cat, const char *name) : cat(cat), name(name), active(enabled())
+      {
+        if (active) begin = clock::now();
+      }
+
+      ~Scope()
+      {
+        if (active) record(cat, name, begin, clock::now());
+      }
+
+      Scope(const Scope &) = delete;
+      Scope &operator=(const Scope &) = delete;
+    };
+
+  } // namespace timeline
+
+} // namespace quda
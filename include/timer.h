@@ -22,7 +22,8 @@ namespace quda {
 
 #else
 
-#include <sys/time.h>
+#include <chrono>
+#include <timeline.h>
 
 #ifdef INTERFACE_NVTX
 #if QUDA_NVTX_VERSION == 3
@@ -36,8 +37,9 @@ namespace quda {
 
   /**
    * Use this for recording a fine-grained profile of a QUDA
-   * algorithm.  This uses host-side measurement, so should be used
-   * for timing fully host-device synchronous algorithms.
+   * algorithm.  This uses host-side measurement with a monotonic
+   * clock, so should be used for timing fully host-device synchronous
+   * algorithms.
    */
   struct Timer {
     /**< The cumulative sum of time */
@@ -47,10 +49,10 @@ namespace quda {
     double last;
 
     /**< Used to store when the timer was last started */
-    timeval start;
+    timeline::clock::time_point start;
 
     /**< Used to store when the timer was last stopped */
-    timeval stop;
+    timeline::clock::time_point stop;
 
     /**< Are we currently timing? */
     bool running;
@@ -65,7 +67,7 @@ namespace quda {
 	printfQuda("ERROR: Cannot start an already running timer (%s:%d in %s())\n", file, line, func);
 	errorQuda("Aborting");
       }
-      gettimeofday(&start, NULL);
+      start = timeline::clock::now();
       running = true;
     }
 
@@ -74,11 +76,9 @@ namespace quda {
 	printfQuda("ERROR: Cannot stop an unstarted timer (%s:%d in %s())\n", file, line, func);
 	errorQuda("Aborting");
       }
-      gettimeofday(&stop, NULL);
+      stop = timeline::clock::now();
 
-      long ds = stop.tv_sec - start.tv_sec;
-      long dus = stop.tv_usec - start.tv_usec;
-      last = ds + 0.000001*dus;
+      last = std::chrono::duration<double>(stop - start).count();
       time += last;
       count++;
 
@@ -113,6 +113,7 @@ namespace quda {
     QUDA_PROFILE_CHRONO,   /**< time spent on chronology */
     QUDA_PROFILE_EIGEN,    /**< time spent on host-side Eigen */
     QUDA_PROFILE_ARPACK,   /**< time spent on host-side ARPACK */
+    QUDA_PROFILE_HOST_REORDER, /**< time spent reordering fields on the host */
 
     // lower level counters used in the dslash and api profiling
     QUDA_PROFILE_LOWER_LEVEL, /**< dummy timer to mark beginning of lower level timers which do not count towrads global time */
@@ -209,6 +210,9 @@ namespace quda {
       global_total_level[idx]++;
     }
 
+    /**< Record the last interval of a given timer on the timeline */
+    void Record(QudaProfileType idx);
+
   public:
     TimeProfile(std::string fname) : fname(fname), switchOff(false), use_global(true) { ; }
 
@@ -233,10 +237,12 @@ namespace quda {
     void Stop_(const char *func, const char *file, int line, QudaProfileType idx) {
       profile[idx].Stop(func, file, line); 
       POP_RANGE
+      if (timeline::enabled()) Record(idx);
 
       // switch off total timer if we need to
       if (switchOff && idx != QUDA_PROFILE_TOTAL) {
         profile[QUDA_PROFILE_TOTAL].Stop(func,file,line);
+        if (timeline::enabled()) Record(QUDA_PROFILE_TOTAL);
         switchOff = false;
       }
       if (use_global) StopGlobal(func,file,line,idx);
@@ -70,10 +70,29 @@ namespace quda {
    * @return tunecache reference
    */
   const std::map<TuneKey, TuneParam> &getTuneCache();
+
+  /**
+   * @brief Look up an entry in the tunecache through its hash index
+   * @param[in] key The key to look up
+   * @return Pointer to the cached launch parameters, or nullptr if
+   * the key is not present
+   */
+  const TuneParam *findTuneParam(const TuneKey &key);
+
+  /**
+   * @brief Remove all entries from the in-memory tunecache.  The
+   * cache files on disk are left untouched.  This invalidates any
+   * references returned by tuneLaunch, so should not be called while
+   * kernels are being launched.
+   */
+  void clearTuneCache();
 #endif
 
   class Tunable {
 
+    // tuneLaunch accumulates the flops and bytes of each launch for the roofline report
+    friend TuneParam &tuneLaunch(Tunable &tunable, QudaTune enabled, QudaVerbosity verbosity);
+
   protected:
     virtual long long flops() const = 0;
     virtual long long bytes() const { return 0; } // FIXME
@@ -312,7 +331,7 @@ namespace quda {
       TuneKey key = tuneKey();
       if (use_managed_memory()) strcat(key.aux, ",managed");
       // if key is present in cache then already tuned
-      return getTuneCache().find(key) != getTuneCache().end();
+      return findTuneParam(key) != nullptr;
 #else
       return true;
 #endif
@@ -593,6 +612,22 @@ namespace quda {
   void loadTuneCache();
   void saveTuneCache(bool error = false);
 
+  /**
+   * @brief Merge a tunecache into the in-memory tunecache.  Where a
+   * key is present in both, the entry with the lower time is kept.
+   * @param[in] path A resource directory (containing tunecache.bin
+   * and/or tunecache.tsv) or a single tunecache file in either format
+   * @return Whether a tunecache was found at path
+   */
+  bool mergeTuneCache(const std::string &path);
+
+  /**
+   * @brief Write the in-memory tunecache to dir/tunecache.tsv and
+   * dir/tunecache.bin, e.g., after merging several caches.
+   * @param[in] dir Output directory
+   */
+  void writeTuneCache(const std::string &dir);
+
   /**
    * @brief Save profile to disk.
    */
@@ -605,11 +640,44 @@ namespace quda {
 
   TuneParam& tuneLaunch(Tunable &tunable, QudaTune enabled, QudaVerbosity verbosity);
 
+  /**
+     @brief Initialize the launch parameters of a host (OpenMP)
+     kernel.  The number of threads is stored in param.aux.x, starting
+     from the maximum available, and the static schedule chunk size in
+     param.aux.y, where zero denotes a contiguous partition.
+     @param[out] param Parameter struct we are initializing
+  */
+  void initHostTuneParam(TuneParam &param);
+
+  /**
+     @brief Advance the launch parameters of a host (OpenMP) kernel:
+     the chunk size is stepped first, and once exhausted the number of
+     threads is halved.
+     @param[in,out] param Parameter struct we are advancing
+     @return Whether a valid parameter set remains
+  */
+  bool advanceHostTuneParam(TuneParam &param);
+
   /**
    * @brief Post an event in the trace, recording where it was posted
    */
   void postTrace_(const char *func, const char *file, int line);
 
+  /**
+   * @brief Stop the kernel trace, writing any outstanding records to
+   * the trace file and closing it
+   */
+  void endTrace();
+
+  /**
+   * @brief Decode a binary kernel trace, as streamed to disk when
+   * QUDA_ENABLE_TRACE is set, writing it out as TSV
+   * @param[in] path Path of the binary trace file
+   * @param[out] out Stream the TSV trace is written to
+   * @return Whether the trace file could be opened
+   */
+  bool decodeTrace(const std::string &path, std::ostream &out);
+
   /**
    * @brief Enable the profile kernel counting
    */
@@ -7,7 +7,8 @@ namespace quda
 
   /**
      @brief VectorIO is a simple wrapper class for loading and saving
-     sets of vector fields using QIO.
+     sets of vector fields using QIO, or the native LIME reader and
+     writer when QIO is not available.
    */
   class VectorIO
   {
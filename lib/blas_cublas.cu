@@ -3,6 +3,7 @@
 #include <cublas_v2.h>
 #endif
 #include <malloc_quda.h>
+#include <sys/time.h>
 
 #define FMULS_GETRF(m_, n_) ( ((m_) < (n_)) \
     ? (0.5 * (m_) * ((m_) * ((n_) - (1./3.) * (m_) - 1. ) + (n_)) + (2. / 3.) * (m_)) \
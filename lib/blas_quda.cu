@@ -131,7 +131,7 @@ namespace quda {
           const int length = x.Length() / (nParity * M);
 
           BlasArg<host_store_t, N, host_y_store_t, Ny, decltype(f_)> arg(x, y, z, w, v, f_, length, nParity);
-          blasCPU<host_real_t, M>(arg);
+          blasCPU<host_real_t, M>(arg, tp.aux.x, tp.aux.y);
         }
       }
 
@@ -155,19 +155,21 @@ namespace quda {
 
       bool advanceTuneParam(TuneParam &param) const
       {
-        return location == QUDA_CPU_FIELD_LOCATION ? false : Tunable::advanceTuneParam(param);
+        return location == QUDA_CPU_FIELD_LOCATION ? advanceHostTuneParam(param) : Tunable::advanceTuneParam(param);
       }
 
       void initTuneParam(TuneParam &param) const
       {
         Tunable::initTuneParam(param);
         param.grid.y = nParity;
+        if (location == QUDA_CPU_FIELD_LOCATION) initHostTuneParam(param);
       }
 
       void defaultTuneParam(TuneParam &param) const
       {
         Tunable::initTuneParam(param);
         param.grid.y = nParity;
+        if (location == QUDA_CPU_FIELD_LOCATION) initHostTuneParam(param);
       }
 
       long long flops() const { return f.flops() * x.Length(); }
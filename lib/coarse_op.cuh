@@ -571,7 +571,10 @@ namespace quda {
       strcpy(aux, compile_type_str(meta));
       strcat(aux, meta.AuxString());
       strcat(aux, comm_dim_partitioned_string());
-      if (meta.Location() == QUDA_CPU_FIELD_LOCATION) strcat(aux, getOmpThreadStr());
+      if (meta.Location() == QUDA_CPU_FIELD_LOCATION) {
+        strcat(aux, getOmpThreadStr());
+        if (!arg.owner_computes) strcat(aux, ",atomic");
+      }
     }
 
     void apply(const qudaStream_t &stream)
@@ -919,6 +922,21 @@ namespace quda {
     typedef CalculateYArg<Float,fineSpin,coarseSpin,fineColor,coarseColor,coarseGauge,coarseGaugeAtomic,fineGauge,F,Ftmp,Vt,fineClover> Arg;
     Arg arg(Y, X, Y_atomic, X_atomic, UV, AV, G, V, C, Cinv, kappa,
 	    mu, mu_factor, x_size, xc_size, geo_bs, spin_bs, fine_to_coarse, coarse_to_fine, bidirectional_links);
+
+    // On the CPU we build each coarse aggregate on a single thread
+    // with no atomics.  This requires the coarse-to-fine map, and that
+    // each aggregate holds the same number of sites of either parity,
+    // which holds if any block dimension is even.  Setting
+    // QUDA_ENABLE_CPU_COARSE_ATOMIC=1 restores the atomic scatter over
+    // fine sites, e.g., for benchmarking.
+    if (location == QUDA_CPU_FIELD_LOCATION && coarse_to_fine) {
+      bool even_block = false;
+      for (int d = 0; d < nDim; d++) if (geo_bs[d] % 2 == 0) even_block = true;
+      char *cpu_atomic_env = getenv("QUDA_ENABLE_CPU_COARSE_ATOMIC");
+      bool cpu_atomic = cpu_atomic_env && strcmp(cpu_atomic_env, "1") == 0;
+      arg.owner_computes = even_block && !cpu_atomic;
+    }
+
     CalculateY<location, from_coarse, Float, fineSpin, fineColor, coarseSpin, coarseColor, Arg> y(arg, v, Y_, X_, Y_atomic_, X_atomic_);
 
     QudaFieldLocation location_ = checkLocation(Y_, X_, av, v);
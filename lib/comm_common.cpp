@@ -1,6 +1,9 @@
 #include <unistd.h> // for gethostname()
 #include <assert.h>
 #include <limits>
+#include <map>
+#include <string>
+#include <vector>
 
 #include <quda_internal.h>
 #include <comm_quda.h>
@@ -65,8 +68,8 @@ static inline bool advance_coords(int ndim, const int *dims, int *x)
 
 char *comm_hostname(void)
 {
-  static bool cached = false;
-  static char hostname[128];
+  static QUDA_RANK_LOCAL bool cached = false;
+  static QUDA_RANK_LOCAL char hostname[128];
 
   if (!cached) {
     gethostname(hostname, 128);
@@ -78,7 +81,7 @@ char *comm_hostname(void)
 }
 
 
-static unsigned long int rand_seed = 137;
+static QUDA_RANK_LOCAL unsigned long int rand_seed = 137;
 
 /**
  * We provide our own random number generator to avoid re-seeding
@@ -149,20 +152,20 @@ void comm_destroy_topology(Topology *topo)
   host_free(topo);
 }
 
-static int gpuid = -1;
+static QUDA_RANK_LOCAL int gpuid = -1;
 
 int comm_gpuid(void) { return gpuid; }
 
-static bool peer2peer_enabled[2][4] = { {false,false,false,false},
+static QUDA_RANK_LOCAL bool peer2peer_enabled[2][4] = { {false,false,false,false},
                                         {false,false,false,false} };
-static bool peer2peer_init = false;
+static QUDA_RANK_LOCAL bool peer2peer_init = false;
 
-static bool intranode_enabled[2][4] = { {false,false,false,false},
+static QUDA_RANK_LOCAL bool intranode_enabled[2][4] = { {false,false,false,false},
 					{false,false,false,false} };
 
 /** this records whether there is any peer-2-peer capability
     (regardless whether it is enabled or not) */
-static bool peer2peer_present = false;
+static QUDA_RANK_LOCAL bool peer2peer_present = false;
 
 /** by default enable both copy engines and load/store access */
 static int enable_peer_to_peer = 3; 
@@ -174,6 +177,14 @@ void comm_peer2peer_init(const char* hostname_recv_buf)
 {
   if (peer2peer_init) return;
 
+#ifdef THREAD_COMMS
+  // CUDA IPC handles cannot be opened by the process that created
+  // them, so peer-to-peer is unavailable between threaded ranks
+  peer2peer_init = true;
+  comm_barrier();
+  return;
+#endif
+
   // set gdr enablement
   if (comm_gdr_enabled()) {
     if (getVerbosity() > QUDA_SILENT) printfQuda("Enabling GPU-Direct RDMA access\n");
@@ -299,7 +310,7 @@ void comm_peer2peer_init(const char* hostname_recv_buf)
 
 bool comm_peer2peer_present() { return peer2peer_present; }
 
-static bool enable_p2p = true;
+static QUDA_RANK_LOCAL bool enable_p2p = true;
 
 bool comm_peer2peer_enabled(int dir, int dim){
   return enable_p2p ? peer2peer_enabled[dir][dim] : false;
@@ -308,8 +319,8 @@ bool comm_peer2peer_enabled(int dir, int dim){
 int comm_peer2peer_enabled_global() {
   if (!enable_p2p) return false;
 
-  static bool init = false;
-  static bool p2p_global = false;
+  static QUDA_RANK_LOCAL bool init = false;
+  static QUDA_RANK_LOCAL bool p2p_global = false;
 
   if (!init) {
     int p2p = 0;
@@ -328,7 +339,7 @@ void comm_enable_peer2peer(bool enable) {
   enable_p2p = enable;
 }
 
-static bool enable_intranode = true;
+static QUDA_RANK_LOCAL bool enable_intranode = true;
 
 bool comm_intranode_enabled(int dir, int dim){
   return enable_intranode ? intranode_enabled[dir][dim] : false;
@@ -389,7 +400,7 @@ int comm_rank_displaced(const Topology *topo, const int displacement[])
 // FIXME: The following routines rely on a "default" topology.
 // They should probably be reworked or eliminated eventually.
 
-Topology *default_topo = NULL;
+QUDA_RANK_LOCAL Topology *default_topo = NULL;
 
 void comm_set_default_topology(Topology *topo)
 {
@@ -405,10 +416,10 @@ Topology *comm_default_topology(void)
   return default_topo;
 }
 
-static int neighbor_rank[2][4] = { {-1,-1,-1,-1},
+static QUDA_RANK_LOCAL int neighbor_rank[2][4] = { {-1,-1,-1,-1},
                                           {-1,-1,-1,-1} };
 
-static bool neighbors_cached = false;
+static QUDA_RANK_LOCAL bool neighbors_cached = false;
 
 void comm_set_neighbor_ranks(Topology *topo){
 
@@ -629,11 +640,11 @@ void comm_finalize(void)
   comm_set_default_topology(NULL);
 }
 
-static char partition_string[16];          /** string that contains the job partitioning */
-static char topology_string[128];          /** string that contains the job topology */
-static char partition_override_string[16]; /** string that contains any overridden partitioning */
+static QUDA_RANK_LOCAL char partition_string[16];          /** string that contains the job partitioning */
+static QUDA_RANK_LOCAL char topology_string[128];          /** string that contains the job topology */
+static QUDA_RANK_LOCAL char partition_override_string[16]; /** string that contains any overridden partitioning */
 
-static int manual_set_partition[QUDA_MAX_DIM] = {0};
+static QUDA_RANK_LOCAL int manual_set_partition[QUDA_MAX_DIM] = {0};
 
 void comm_dim_partitioned_set(int dim)
 { 
@@ -667,14 +678,18 @@ int comm_partitioned()
 }
 
 bool comm_gdr_enabled() {
-  static bool gdr_enabled = false;
+  static QUDA_RANK_LOCAL bool gdr_enabled = false;
 #ifdef MULTI_GPU
-  static bool gdr_init = false;
+  static QUDA_RANK_LOCAL bool gdr_init = false;
 
   if (!gdr_init) {
     char *enable_gdr_env = getenv("QUDA_ENABLE_GDR");
     if (enable_gdr_env && strcmp(enable_gdr_env, "1") == 0) {
+#ifdef THREAD_COMMS
+      warningQuda("GPU-Direct RDMA is not supported by the threaded communications backend");
+#else
       gdr_enabled = true;
+#endif
     }
     gdr_init = true;
   }
@@ -683,8 +698,8 @@ bool comm_gdr_enabled() {
 }
 
 bool comm_gdr_blacklist() {
-  static bool blacklist = false;
-  static bool blacklist_init = false;
+  static QUDA_RANK_LOCAL bool blacklist = false;
+  static QUDA_RANK_LOCAL bool blacklist_init = false;
 
   if (!blacklist_init) {
     char *blacklist_env = getenv("QUDA_ENABLE_GDR_BLACKLIST");
@@ -715,16 +730,181 @@ bool comm_gdr_blacklist() {
   return blacklist;
 }
 
-static bool deterministic_reduce = false;
+static QUDA_RANK_LOCAL bool deterministic_reduce = false;
+static QUDA_RANK_LOCAL bool deterministic_tree_reduce = false;
+
+/** relative face volume of each dimension, used to weight the halo surface */
+static QUDA_RANK_LOCAL double face_weight[QUDA_MAX_DIM] = {1.0, 1.0, 1.0, 1.0, 1.0, 1.0};
+
+/** whether face_weight was set from the local lattice dimensions */
+static QUDA_RANK_LOCAL bool face_weight_set = false;
+
+/** the node-aware rank map: the rank at each grid coordinate, indexed as Topology::ranks */
+static QUDA_RANK_LOCAL std::vector<int> node_local_map;
+static QUDA_RANK_LOCAL int node_local_ndim;
+static QUDA_RANK_LOCAL int node_local_dims[QUDA_MAX_DIM];
+
+int comm_rank_from_coords_node_local(const int *coords, void *)
+{
+  return node_local_map[index(node_local_ndim, node_local_dims, coords)];
+}
+
+/**
+   @brief Find the sub-block of the process grid, with the given
+   number of ranks, that minimizes the halo surface between blocks
+   @param[out] block Best sub-block found so far
+   @param[in,out] best_cost Inter-node surface of block
+   @param[in] trial Sub-block being constructed
+   @param[in] d Dimension of trial being set
+   @param[in] remaining Number of ranks still to be assigned to dimensions d and above
+*/
+static void find_node_block(int ndim, const int *dims, int *block, double &best_cost, int *trial, int d,
+                            int remaining)
+{
+  if (d == ndim) {
+    if (remaining != 1) return;
+    int n_local = 1;
+    for (int i = 0; i < ndim; i++) n_local *= trial[i];
+    double cost = 0.0;
+    for (int i = 0; i < ndim; i++) {
+      // every rank on the boundary of the block in dimension i has an off-node neighbor in each direction
+      if (trial[i] < dims[i]) cost += 2.0 * (n_local / trial[i]) * face_weight[i];
+    }
+    if (cost < best_cost) {
+      best_cost = cost;
+      for (int i = 0; i < ndim; i++) block[i] = trial[i];
+    }
+    return;
+  }
+
+  for (int b = 1; b <= dims[d]; b++) {
+    if (dims[d] % b != 0 || remaining % b != 0) continue;
+    trial[d] = b;
+    find_node_block(ndim, dims, block, best_cost, trial, d + 1, remaining / b);
+  }
+}
+
+/**
+   @brief Construct the node-aware rank map (see comm_rank_from_coords_node_local)
+   @param[in] hostname_recv_buf The hostnames of all ranks
+   @param[in] local_dims Optional local lattice dimensions
+*/
+static void comm_set_node_local_map(int ndim, const int *dims, const char *hostname_recv_buf, const int *local_dims)
+{
+  const int size = comm_size();
+  node_local_ndim = ndim;
+  for (int d = 0; d < ndim; d++) node_local_dims[d] = dims[d];
+  node_local_map.resize(size);
+
+  for (int d = 0; d < ndim; d++) {
+    face_weight[d] = 1.0;
+    if (local_dims)
+      for (int e = 0; e < ndim; e++)
+        if (e != d) face_weight[d] *= local_dims[e];
+  }
+  face_weight_set = local_dims != nullptr;
+
+  // group the ranks by node, with the nodes ordered by their lowest rank
+  std::map<std::string, int> node_index;
+  std::vector<std::vector<int>> nodes;
+  for (int r = 0; r < size; r++) {
+    std::string hostname(&hostname_recv_buf[128 * r], strnlen(&hostname_recv_buf[128 * r], 128));
+    auto it = node_index.find(hostname);
+    if (it == node_index.end()) {
+      it = node_index.insert(std::make_pair(hostname, static_cast<int>(nodes.size()))).first;
+      nodes.emplace_back();
+    }
+    nodes[it->second].push_back(r);
+  }
+
+  const int n_local = nodes[0].size();
+  int block[QUDA_MAX_DIM];
+  bool valid = true;
+  for (auto &node : nodes)
+    if (static_cast<int>(node.size()) != n_local) valid = false;
+
+  if (valid) {
+    int trial[QUDA_MAX_DIM];
+    double best_cost = std::numeric_limits<double>::max();
+    find_node_block(ndim, dims, block, best_cost, trial, 0, n_local);
+    valid = best_cost < std::numeric_limits<double>::max();
+  }
+
+  if (!valid) {
+    warningQuda("Unable to factor the process grid into blocks of ranks per node, using the lexicographic rank map");
+    for (int r = 0; r < size; r++) node_local_map[r] = r;
+    return;
+  }
+
+  int node_dims[QUDA_MAX_DIM];
+  for (int d = 0; d < ndim; d++) node_dims[d] = dims[d] / block[d];
+
+  int node_coords[QUDA_MAX_DIM] = {};
+  for (auto &node : nodes) {
+    int local_coords[QUDA_MAX_DIM] = {};
+    for (int rank : node) {
+      int coords[QUDA_MAX_DIM];
+      for (int d = 0; d < ndim; d++) coords[d] = node_coords[d] * block[d] + local_coords[d];
+      node_local_map[index(ndim, dims, coords)] = rank;
+      advance_coords(ndim, block, local_coords);
+    }
+    advance_coords(ndim, node_dims, node_coords);
+  }
+
+  if (getVerbosity() >= QUDA_SUMMARIZE) {
+    std::string block_string = std::to_string(block[0]);
+    for (int d = 1; d < ndim; d++) block_string += "x" + std::to_string(block[d]);
+    printfQuda("Node-aware rank map: %lu nodes with a %s block of ranks each\n", nodes.size(), block_string.c_str());
+  }
+}
+
+/**
+   @brief Report how much of the halo surface of the process grid is
+   between ranks on the same node, as opposed to between nodes.  The
+   number of faces is always reported, so that the reports of
+   different rank maps can be compared, and the face-volume weighted
+   surface is also reported when the local lattice dimensions are known.
+   @param[in] hostname_recv_buf The hostnames of all ranks
+*/
+static void comm_report_node_locality(const char *hostname_recv_buf)
+{
+  double surface[4] = {0.0, 0.0, 0.0, 0.0}; // intra-node and inter-node faces, then weighted by face volume
+  for (int dim = 0; dim < 4; dim++) {
+    if (!comm_dim_partitioned(dim)) continue;
+    for (int dir = 0; dir < 2; dir++) {
+      const int neighbor = comm_neighbor_rank(dir, dim);
+      const bool local = !strncmp(comm_hostname(), &hostname_recv_buf[128 * neighbor], 128);
+      surface[local ? 0 : 1] += 1.0;
+      surface[local ? 2 : 3] += face_weight[dim];
+    }
+  }
+  comm_allreduce_array(surface, 4);
+
+  auto report = [](const char *what, double intra, double inter) {
+    printfQuda("%s %.1f%% intra-node, %.1f%% inter-node (intra/inter ratio = %g)\n", what,
+               100.0 * intra / (intra + inter), 100.0 * inter / (intra + inter),
+               inter > 0.0 ? intra / inter : std::numeric_limits<double>::infinity());
+  };
+
+  if (surface[0] + surface[1] > 0.0 && getVerbosity() >= QUDA_SUMMARIZE) {
+    report("Halo faces are", surface[0], surface[1]);
+    if (face_weight_set) report("Halo surface weighted by face volume is", surface[2], surface[3]);
+  }
+}
 
 void comm_init_common(int ndim, const int *dims, QudaCommsMap rank_from_coords, void *map_data)
 {
+  // the hostnames determine which GPU this rank will use, and may determine the rank map
+  char *hostname_recv_buf = (char *)safe_malloc(128 * comm_size());
+  comm_gather_hostname(hostname_recv_buf);
+
+  if (rank_from_coords == comm_rank_from_coords_node_local)
+    comm_set_node_local_map(ndim, dims, hostname_recv_buf, static_cast<const int *>(map_data));
+
   Topology *topo = comm_create_topology(ndim, dims, rank_from_coords, map_data);
   comm_set_default_topology(topo);
 
-  // determine which GPU this rank will use
-  char *hostname_recv_buf = (char *)safe_malloc(128 * comm_size());
-  comm_gather_hostname(hostname_recv_buf);
+  comm_report_node_locality(hostname_recv_buf);
 
   gpuid = 0;
   for (int i = 0; i < comm_rank(); i++) {
@@ -734,6 +914,10 @@ void comm_init_common(int ndim, const int *dims, QudaCommsMap rank_from_coords,
   int device_count;
   cudaGetDeviceCount(&device_count);
   if (device_count == 0) { errorQuda("No CUDA devices found"); }
+#ifdef THREAD_COMMS
+  // threaded ranks share the devices of the one process
+  gpuid = gpuid % device_count;
+#endif
   if (gpuid >= device_count) {
     char *enable_mps_env = getenv("QUDA_ENABLE_MPS");
     if (enable_mps_env && strcmp(enable_mps_env, "1") == 0) {
@@ -750,6 +934,10 @@ void comm_init_common(int ndim, const int *dims, QudaCommsMap rank_from_coords,
 
   char *enable_reduce_env = getenv("QUDA_DETERMINISTIC_REDUCE");
   if (enable_reduce_env && strcmp(enable_reduce_env, "1") == 0) { deterministic_reduce = true; }
+  if (enable_reduce_env && strcmp(enable_reduce_env, "tree") == 0) {
+    deterministic_reduce = true;
+    deterministic_tree_reduce = true;
+  }
 
   snprintf(partition_string, 16, ",comm=%d%d%d%d", comm_dim_partitioned(0), comm_dim_partitioned(1),
            comm_dim_partitioned(2), comm_dim_partitioned(3));
@@ -785,8 +973,8 @@ void comm_init_common(int ndim, const int *dims, QudaCommsMap rank_from_coords,
 
 const char *comm_config_string()
 {
-  static char config_string[64];
-  static bool config_init = false;
+  static QUDA_RANK_LOCAL char config_string[64];
+  static QUDA_RANK_LOCAL bool config_init = false;
 
   if (!config_init) {
     strcpy(config_string, ",p2p=");
@@ -822,8 +1010,10 @@ const char *comm_dim_topology_string() { return topology_string; }
 
 bool comm_deterministic_reduce() { return deterministic_reduce; }
 
-static bool globalReduce = true;
-static bool asyncReduce = false;
+bool comm_deterministic_tree_reduce() { return deterministic_tree_reduce; }
+
+static QUDA_RANK_LOCAL bool globalReduce = true;
+static QUDA_RANK_LOCAL bool asyncReduce = false;
 
 void reduceMaxDouble(double &max) { comm_allreduce_max(&max); }
 
@@ -832,6 +1022,18 @@ void reduceDouble(double &sum) { if (globalReduce) comm_allreduce(&sum); }
 void reduceDoubleArray(double *sum, const int len)
 { if (globalReduce) comm_allreduce_array(sum, len); }
 
+ReduceHandle *reduceDoubleArrayStart(double *sum, const int len)
+{
+  return globalReduce ? comm_allreduce_array_start(sum, len) : nullptr;
+}
+
+bool reduceTest(ReduceHandle *rh) { return rh ? comm_allreduce_test(rh) : true; }
+
+void reduceWait(ReduceHandle *&rh)
+{
+  if (rh) comm_allreduce_wait(rh);
+}
+
 int commDim(int dir) { return comm_dim(dir); }
 
 int commCoords(int dir) { return comm_coord(dir); }
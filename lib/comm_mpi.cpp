@@ -3,6 +3,8 @@
 #include <cstring>
 #include <algorithm>
 #include <numeric>
+#include <limits>
+#include <vector>
 #include <mpi.h>
 #include <quda_internal.h>
 #include <comm_quda.h>
@@ -39,6 +41,14 @@ struct MsgHandle_s {
   bool custom;
 };
 
+struct ReduceHandle_s {
+  /**
+     The request for the non-blocking reduction, or MPI_REQUEST_NULL
+     if the reduction was completed when it was started.
+   */
+  MPI_Request request;
+};
+
 static int rank = -1;
 static int size = -1;
 
@@ -213,12 +223,14 @@ void comm_free(MsgHandle *&mh)
 
 void comm_start(MsgHandle *mh)
 {
+  if (quda::timeline::enabled()) quda::timeline::instant("comms", "comm_start");
   MPI_CHECK( MPI_Start(&(mh->request)) );
 }
 
 
 void comm_wait(MsgHandle *mh)
 {
+  quda::timeline::Scope scope("comms", "comm_wait");
   MPI_CHECK( MPI_Wait(&(mh->request), MPI_STATUS_IGNORE) );
 }
 
@@ -237,24 +249,62 @@ template <typename T> T deterministic_reduce(T *array, int n)
   return std::accumulate(array, array + n, 0.0);
 }
 
+// tag for the deterministic tree reduction, outside the range used by the halo exchange
+static const int tree_reduce_tag = 2 * 16 * 16 * 16 * 16 + 1;
+
+/**
+   @brief Deterministic sum over a binomial tree in rank order.  At
+   step s, each rank with bit s set sends its partial sum to rank -
+   2^s and drops out, while its partner adds the received partial to
+   its own.  The order of summation depends only on the number of
+   processes, so the result is reproducible from run to run, with
+   O(log P) latency and O(size) memory.  The sum is formed on rank 0
+   and then broadcast, so all processes see an identical result.
+   @param[in,out] data Local contribution on input, global sum on output
+   @param[in] size Number of elements
+*/
+static void tree_reduce(double *data, size_t size)
+{
+  const int n = comm_size();
+  const int me = comm_rank();
+  double *recv_buf = (double *)pool_host_malloc(size * sizeof(double));
+
+  for (int mask = 1; mask < n; mask <<= 1) {
+    if (me & mask) {
+      MPI_CHECK(MPI_Send(data, size, MPI_DOUBLE, me - mask, tree_reduce_tag, MPI_COMM_HANDLE));
+      break;
+    } else if (me + mask < n) {
+      MPI_CHECK(MPI_Recv(recv_buf, size, MPI_DOUBLE, me + mask, tree_reduce_tag, MPI_COMM_HANDLE, MPI_STATUS_IGNORE));
+      for (size_t i = 0; i < size; i++) data[i] += recv_buf[i];
+    }
+  }
+
+  MPI_CHECK(MPI_Bcast(data, size, MPI_DOUBLE, 0, MPI_COMM_HANDLE));
+  pool_host_free(recv_buf);
+}
+
 void comm_allreduce(double* data)
 {
+  quda::timeline::Scope scope("comms", "comm_allreduce");
   if (!comm_deterministic_reduce()) {
     double recvbuf;
     MPI_CHECK(MPI_Allreduce(data, &recvbuf, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_HANDLE));
     *data = recvbuf;
+  } else if (comm_deterministic_tree_reduce()) {
+    tree_reduce(data, 1);
   } else {
     const size_t n = comm_size();
-    double *recv_buf = (double *)safe_malloc(n * sizeof(double));
+    double *recv_buf = (double *)pool_host_malloc(n * sizeof(double));
     MPI_CHECK(MPI_Allgather(data, 1, MPI_DOUBLE, recv_buf, 1, MPI_DOUBLE, MPI_COMM_HANDLE));
     *data = deterministic_reduce(recv_buf, n);
-    host_free(recv_buf);
+    pool_host_free(recv_buf);
   }
 }
 
 
 void comm_allreduce_max(double* data)
 {
+  quda::timeline::Scope scope("comms", "comm_allreduce_max");
   double recvbuf;
   MPI_CHECK(MPI_Allreduce(data, &recvbuf, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_HANDLE));
   *data = recvbuf;
@@ -262,6 +312,7 @@ void comm_allreduce_max(double* data)
 
 void comm_allreduce_min(double* data)
 {
+  quda::timeline::Scope scope("comms", "comm_allreduce_min");
   double recvbuf;
   MPI_CHECK(MPI_Allreduce(data, &recvbuf, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_HANDLE));
   *data = recvbuf;
@@ -269,30 +320,63 @@ void comm_allreduce_min(double* data)
 
 void comm_allreduce_array(double* data, size_t size)
 {
+  quda::timeline::Scope scope("comms", "comm_allreduce_array");
   if (!comm_deterministic_reduce()) {
     double *recvbuf = new double[size];
     MPI_CHECK(MPI_Allreduce(data, recvbuf, size, MPI_DOUBLE, MPI_SUM, MPI_COMM_HANDLE));
     memcpy(data, recvbuf, size * sizeof(double));
     delete[] recvbuf;
+  } else if (comm_deterministic_tree_reduce()) {
+    tree_reduce(data, size);
   } else {
     size_t n = comm_size();
-    double *recv_buf = new double[size * n];
+    double *recv_buf = (double *)pool_host_malloc(size * n * sizeof(double));
     MPI_CHECK(MPI_Allgather(data, size, MPI_DOUBLE, recv_buf, size, MPI_DOUBLE, MPI_COMM_HANDLE));
 
-    double *recv_trans = new double[size * n];
+    double *recv_trans = (double *)pool_host_malloc(size * n * sizeof(double));
     for (size_t i = 0; i < n; i++) {
       for (size_t j = 0; j < size; j++) { recv_trans[j * n + i] = recv_buf[i * size + j]; }
     }
 
     for (size_t i = 0; i < size; i++) { data[i] = deterministic_reduce(recv_trans + i * n, n); }
 
-    delete[] recv_buf;
-    delete[] recv_trans;
+    pool_host_free(recv_buf);
+    pool_host_free(recv_trans);
+  }
+}
+
+ReduceHandle *comm_allreduce_array_start(double *data, size_t size)
+{
+  quda::timeline::Scope scope("comms", "comm_allreduce_array_start");
+  ReduceHandle *rh = (ReduceHandle *)safe_malloc(sizeof(ReduceHandle));
+  if (!comm_deterministic_reduce()) {
+    MPI_CHECK(MPI_Iallreduce(MPI_IN_PLACE, data, size, MPI_DOUBLE, MPI_SUM, MPI_COMM_HANDLE, &(rh->request)));
+  } else {
+    // the deterministic reductions have no non-blocking variant, so complete eagerly
+    comm_allreduce_array(data, size);
+    rh->request = MPI_REQUEST_NULL;
   }
+  return rh;
+}
+
+int comm_allreduce_test(ReduceHandle *rh)
+{
+  int query;
+  MPI_CHECK(MPI_Test(&(rh->request), &query, MPI_STATUS_IGNORE));
+  return query;
+}
+
+void comm_allreduce_wait(ReduceHandle *&rh)
+{
+  quda::timeline::Scope scope("comms", "comm_allreduce_wait");
+  MPI_CHECK(MPI_Wait(&(rh->request), MPI_STATUS_IGNORE));
+  host_free(rh);
+  rh = nullptr;
 }
 
 void comm_allreduce_max_array(double* data, size_t size)
 {
+  quda::timeline::Scope scope("comms", "comm_allreduce_max_array");
   double *recvbuf = new double[size];
   MPI_CHECK(MPI_Allreduce(data, recvbuf, size, MPI_DOUBLE, MPI_MAX, MPI_COMM_HANDLE));
   memcpy(data, recvbuf, size*sizeof(double));
@@ -301,6 +385,7 @@ void comm_allreduce_max_array(double* data, size_t size)
 
 void comm_allreduce_int(int* data)
 {
+  quda::timeline::Scope scope("comms", "comm_allreduce_int");
   int recvbuf;
   MPI_CHECK(MPI_Allreduce(data, &recvbuf, 1, MPI_INT, MPI_SUM, MPI_COMM_HANDLE));
   *data = recvbuf;
@@ -318,10 +403,35 @@ void comm_allreduce_xor(uint64_t *data)
 /**  broadcast from rank 0 */
 void comm_broadcast(void *data, size_t nbytes)
 {
+  quda::timeline::Scope scope("comms", "comm_broadcast");
   MPI_CHECK(MPI_Bcast(data, (int)nbytes, MPI_BYTE, 0, MPI_COMM_HANDLE));
 }
 
-void comm_barrier(void) { MPI_CHECK(MPI_Barrier(MPI_COMM_HANDLE)); }
+void comm_gather_bytes(void *recv_buf, const size_t *recv_bytes, const void *send_buf, size_t send_bytes)
+{
+  quda::timeline::Scope scope("comms", "comm_gather_bytes");
+  std::vector<int> counts, displs;
+  if (comm_rank() == 0) {
+    counts.resize(comm_size());
+    displs.resize(comm_size());
+    size_t offset = 0;
+    for (int i = 0; i < comm_size(); i++) {
+      if (offset + recv_bytes[i] > static_cast<size_t>(std::numeric_limits<int>::max()))
+        errorQuda("Gather of %lu bytes exceeds MPI count limit", offset + recv_bytes[i]);
+      counts[i] = recv_bytes[i];
+      displs[i] = offset;
+      offset += recv_bytes[i];
+    }
+  }
+  MPI_CHECK(MPI_Gatherv(send_buf, (int)send_bytes, MPI_BYTE, recv_buf, counts.data(), displs.data(), MPI_BYTE, 0,
+                        MPI_COMM_HANDLE));
+}
+
+void comm_barrier(void)
+{
+  quda::timeline::Scope scope("comms", "comm_barrier");
+  MPI_CHECK(MPI_Barrier(MPI_COMM_HANDLE));
+}
 
 void comm_abort_(int status)
 {
@@ -0,0 +1,467 @@
+/**
+   In-process communications backend, in which each rank is a thread
+   of a single process.  Ranks are launched with comm_threads_launch,
+   after which each rank thread initializes the communications grid
+   as it would with any other backend.
+
+   Point-to-point messages are matched by (source, destination, tag),
+   in the order in which they were started, as with MPI.  The first of
+   a matching send and receive to be started is queued, and the second
+   copies the message directly from the send buffer into the receive
+   buffer, so there is no intermediate staging.  Collectives are
+   performed between barriers, with each rank reading the other ranks'
+   contributions in place, and sums are always formed in rank order,
+   so all reductions are deterministic.
+
+   Only host buffers may be communicated, so GPU-Direct RDMA and
+   peer-to-peer access are not available with this backend.
+
+   When comm_init is called outside of comm_threads_launch, as by the
+   tests other than comm_threads_test, the calling thread forms a
+   single-rank world, so a 1x1x1x1 grid behaves as it would with the
+   single-process backend.
+
+   The backend is scoped to the communications layer: the rank
+   threads may use the comm_* API (and the print/verbosity helpers),
+   whose per-rank state is thread local (see QUDA_RANK_LOCAL).  State
+   above that layer is process wide and unsynchronized, e.g., the
+   static cpuColorSpinorField ghost buffers and halo-exchange plans,
+   the tunecache, the kernel trace, the solver telemetry and the
+   timeline, so fields, Dirac operators and solvers, including the
+   host reference code, must not be used from more than one rank
+   thread.  initQuda is therefore rejected when there is more than
+   one rank.
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include <quda_internal.h>
+#include <comm_quda.h>
+
+struct MsgHandle_s {
+  /**
+     The message buffer, which is a sequence of nblocks blocks of
+     blksize bytes separated by stride bytes
+   */
+  char *buffer;
+  size_t blksize;
+  int nblocks;
+  size_t stride;
+
+  /**
+     Whether this is a send or a receive
+   */
+  bool send;
+
+  /**
+     The channel on which this message is matched
+   */
+  struct Channel *channel;
+
+  /**
+     Set when the message has been copied from the send to the
+     receive buffer
+   */
+  std::atomic<bool> complete;
+};
+
+struct ReduceHandle_s {
+  /**
+     The reductions are completed when they are started, so there is
+     no state to track
+   */
+  int dummy;
+};
+
+/**
+   Messages between a given pair of ranks with a given tag.  At most
+   one of the queues is non-empty at any time.
+ */
+struct Channel {
+  std::mutex mutex;
+  std::deque<MsgHandle *> sends;
+  std::deque<MsgHandle *> recvs;
+};
+
+namespace {
+
+  struct World {
+    int size;
+
+    std::mutex channel_mutex;
+    std::map<std::tuple<int, int, int>, Channel> channels;
+
+    /**
+       Generation-counting barrier
+     */
+    std::mutex barrier_mutex;
+    std::condition_variable barrier_cv;
+    int barrier_count = 0;
+    unsigned long barrier_generation = 0;
+
+    /**
+       Per-rank pointers to the contributions to a collective, which
+       are valid between the two barriers that bracket it
+     */
+    std::vector<const void *> contribution;
+
+    World(int size) : size(size), contribution(size, nullptr) { }
+  };
+
+  World *world = nullptr;
+
+  /**
+     Whether the world is the single-rank one created by comm_init
+     outside of comm_threads_launch
+   */
+  bool implicit_world = false;
+
+  thread_local int rank = -1;
+
+} // namespace
+
+void comm_threads_launch(int nranks, void (*rank_main)(void *), void *arg)
+{
+  if (implicit_world) errorQuda("Threaded ranks cannot be launched after the communications grid is initialized");
+  if (world) errorQuda("Threaded ranks have already been launched");
+  if (nranks < 1) errorQuda("Invalid number of ranks %d", nranks);
+
+  world = new World(nranks);
+
+  std::vector<std::thread> threads;
+  threads.reserve(nranks);
+  for (int r = 0; r < nranks; r++) {
+    threads.emplace_back([=] {
+      rank = r;
+      rank_main(arg);
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  delete world;
+  world = nullptr;
+}
+
+void comm_init(int ndim, const int *dims, QudaCommsMap rank_from_coords, void *map_data)
+{
+  int grid_size = 1;
+  for (int i = 0; i < ndim; i++) { grid_size *= dims[i]; }
+
+  if (!world) {
+    // without comm_threads_launch this process is a single-rank world, as with the single-process backend
+    if (grid_size != 1)
+      errorQuda("A communication grid of %d ranks requires the ranks to be launched with comm_threads_launch",
+                grid_size);
+    world = new World(1);
+    implicit_world = true;
+    rank = 0;
+  } else if (rank < 0) {
+    errorQuda("comm_init must be called from a rank launched with comm_threads_launch");
+  }
+  if (grid_size != world->size) {
+    errorQuda("Communication grid size declared via initCommsGridQuda() does not match"
+              " total number of threaded ranks (%d != %d)",
+              grid_size, world->size);
+  }
+
+  comm_init_common(ndim, dims, rank_from_coords, map_data);
+}
+
+int comm_rank(void) { return rank; }
+
+int comm_size(void) { return world ? world->size : 1; }
+
+void comm_barrier(void)
+{
+  quda::timeline::Scope scope("comms", "comm_barrier");
+  std::unique_lock<std::mutex> lock(world->barrier_mutex);
+  const unsigned long generation = world->barrier_generation;
+  if (++world->barrier_count == world->size) {
+    world->barrier_count = 0;
+    world->barrier_generation++;
+    world->barrier_cv.notify_all();
+  } else {
+    world->barrier_cv.wait(lock, [&] { return world->barrier_generation != generation; });
+  }
+}
+
+/**
+   @brief Make this rank's contribution to a collective visible to
+   the other ranks, and wait for all of them to do the same
+   @param[in] data This rank's contribution
+ */
+static void post_contribution(const void *data)
+{
+  world->contribution[rank] = data;
+  comm_barrier();
+}
+
+/**
+   @brief Wait until all ranks have finished reading the
+   contributions, after which they may be modified
+ */
+static void release_contributions() { comm_barrier(); }
+
+/**
+   @brief Reduce an array over all ranks in rank order, which makes
+   the result independent of thread scheduling
+ */
+template <typename T, typename Reducer> static void allreduce(T *data, size_t size, Reducer reducer)
+{
+  post_contribution(data);
+  const T *first = static_cast<const T *>(world->contribution[0]);
+  std::vector<T> result(first, first + size);
+  for (int r = 1; r < world->size; r++) {
+    const T *contribution = static_cast<const T *>(world->contribution[r]);
+    for (size_t i = 0; i < size; i++) result[i] = reducer(result[i], contribution[i]);
+  }
+  release_contributions();
+  std::copy(result.begin(), result.end(), data);
+}
+
+void comm_gather_hostname(char *hostname_recv_buf)
+{
+  post_contribution(comm_hostname());
+  for (int r = 0; r < world->size; r++)
+    memcpy(hostname_recv_buf + 128 * r, world->contribution[r], 128);
+  release_contributions();
+}
+
+void comm_gather_gpuid(int *gpuid_recv_buf)
+{
+  int gpuid = comm_gpuid();
+  post_contribution(&gpuid);
+  for (int r = 0; r < world->size; r++) gpuid_recv_buf[r] = *static_cast<const int *>(world->contribution[r]);
+  release_contributions();
+}
+
+static const int max_displacement = 4;
+
+static void check_displacement(const int displacement[], int ndim)
+{
+  for (int i = 0; i < ndim; i++) {
+    if (abs(displacement[i]) > max_displacement) {
+      errorQuda("Requested displacement[%d] = %d is greater than maximum allowed", i, displacement[i]);
+    }
+  }
+}
+
+/**
+   @brief Create a message handle, matching messages with the same
+   tag convention as the MPI backend
+   @param[in] send Whether this is a send or a receive
+ */
+static MsgHandle *declare_message(bool send, void *buffer, const int displacement[], size_t blksize, int nblocks,
+                                  size_t stride)
+{
+  Topology *topo = comm_default_topology();
+  int ndim = comm_ndim(topo);
+  check_displacement(displacement, ndim);
+
+  int peer = comm_rank_displaced(topo, displacement);
+
+  int tag = 0;
+  for (int i = ndim - 1; i >= 0; i--)
+    tag = tag * 4 * max_displacement + (send ? displacement[i] : -displacement[i]) + max_displacement;
+
+  MsgHandle *mh = new MsgHandle;
+  mh->buffer = static_cast<char *>(buffer);
+  mh->blksize = blksize;
+  mh->nblocks = nblocks;
+  mh->stride = stride;
+  mh->send = send;
+  mh->complete = true;
+
+  std::lock_guard<std::mutex> lock(world->channel_mutex);
+  mh->channel = &world->channels[send ? std::make_tuple(rank, peer, tag) : std::make_tuple(peer, rank, tag)];
+
+  return mh;
+}
+
+MsgHandle *comm_declare_send_displaced(void *buffer, const int displacement[], size_t nbytes)
+{
+  return declare_message(true, buffer, displacement, nbytes, 1, nbytes);
+}
+
+MsgHandle *comm_declare_receive_displaced(void *buffer, const int displacement[], size_t nbytes)
+{
+  return declare_message(false, buffer, displacement, nbytes, 1, nbytes);
+}
+
+MsgHandle *comm_declare_strided_send_displaced(void *buffer, const int displacement[], size_t blksize, int nblocks,
+                                               size_t stride)
+{
+  return declare_message(true, buffer, displacement, blksize, nblocks, stride);
+}
+
+MsgHandle *comm_declare_strided_receive_displaced(void *buffer, const int displacement[], size_t blksize, int nblocks,
+                                                  size_t stride)
+{
+  return declare_message(false, buffer, displacement, blksize, nblocks, stride);
+}
+
+void comm_free(MsgHandle *&mh)
+{
+  if (!mh->complete) errorQuda("Freeing a message handle that has not completed");
+  delete mh;
+  mh = nullptr;
+}
+
+/**
+   @brief Copy a message from a send buffer directly into the matching
+   receive buffer, where either may be strided
+ */
+static void copy_message(MsgHandle *recv, const MsgHandle *send)
+{
+  const size_t send_bytes = send->blksize * send->nblocks;
+  const size_t recv_bytes = recv->blksize * recv->nblocks;
+  if (send_bytes != recv_bytes) errorQuda("Message size mismatch: sent %lu bytes, expected %lu", send_bytes, recv_bytes);
+
+  if (send->nblocks == 1 && recv->nblocks == 1) {
+    memcpy(recv->buffer, send->buffer, send_bytes);
+    return;
+  }
+
+  // walk both block structures, copying the largest contiguous piece each time
+  int send_block = 0, recv_block = 0;
+  size_t send_offset = 0, recv_offset = 0;
+  while (send_block < send->nblocks && recv_block < recv->nblocks) {
+    size_t bytes = std::min(send->blksize - send_offset, recv->blksize - recv_offset);
+    memcpy(recv->buffer + recv_block * recv->stride + recv_offset,
+           send->buffer + send_block * send->stride + send_offset, bytes);
+    send_offset += bytes;
+    recv_offset += bytes;
+    if (send_offset == send->blksize) {
+      send_block++;
+      send_offset = 0;
+    }
+    if (recv_offset == recv->blksize) {
+      recv_block++;
+      recv_offset = 0;
+    }
+  }
+}
+
+void comm_start(MsgHandle *mh)
+{
+  if (quda::timeline::enabled()) quda::timeline::instant("comms", "comm_start");
+  if (!mh->complete) errorQuda("Starting a message handle that is already active");
+  mh->complete.store(false, std::memory_order_relaxed);
+
+  Channel &channel = *mh->channel;
+  std::lock_guard<std::mutex> lock(channel.mutex);
+  auto &pending = mh->send ? channel.recvs : channel.sends;
+  if (pending.empty()) {
+    (mh->send ? channel.sends : channel.recvs).push_back(mh);
+  } else {
+    MsgHandle *match = pending.front();
+    pending.pop_front();
+    if (mh->send)
+      copy_message(match, mh);
+    else
+      copy_message(mh, match);
+    match->complete.store(true, std::memory_order_release);
+    mh->complete.store(true, std::memory_order_release);
+  }
+}
+
+void comm_wait(MsgHandle *mh)
+{
+  quda::timeline::Scope scope("comms", "comm_wait");
+  // the matching operation is started by a thread that is running, so spin rather than sleep to minimize latency
+  while (!mh->complete.load(std::memory_order_acquire)) std::this_thread::yield();
+}
+
+int comm_query(MsgHandle *mh) { return mh->complete.load(std::memory_order_acquire); }
+
+void comm_allreduce(double *data)
+{
+  quda::timeline::Scope scope("comms", "comm_allreduce");
+  allreduce(data, 1, [](double a, double b) { return a + b; });
+}
+
+void comm_allreduce_max(double *data)
+{
+  quda::timeline::Scope scope("comms", "comm_allreduce_max");
+  allreduce(data, 1, [](double a, double b) { return std::max(a, b); });
+}
+
+void comm_allreduce_min(double *data)
+{
+  quda::timeline::Scope scope("comms", "comm_allreduce_min");
+  allreduce(data, 1, [](double a, double b) { return std::min(a, b); });
+}
+
+void comm_allreduce_array(double *data, size_t size)
+{
+  quda::timeline::Scope scope("comms", "comm_allreduce_array");
+  allreduce(data, size, [](double a, double b) { return a + b; });
+}
+
+ReduceHandle *comm_allreduce_array_start(double *data, size_t size)
+{
+  quda::timeline::Scope scope("comms", "comm_allreduce_array_start");
+  // with all ranks in one process there is no network latency to hide, so complete eagerly
+  comm_allreduce_array(data, size);
+  return (ReduceHandle *)safe_malloc(sizeof(ReduceHandle));
+}
+
+int comm_allreduce_test(ReduceHandle *rh) { return 1; }
+
+void comm_allreduce_wait(ReduceHandle *&rh)
+{
+  host_free(rh);
+  rh = nullptr;
+}
+
+void comm_allreduce_max_array(double *data, size_t size)
+{
+  quda::timeline::Scope scope("comms", "comm_allreduce_max_array");
+  allreduce(data, size, [](double a, double b) { return std::max(a, b); });
+}
+
+void comm_allreduce_int(int *data)
+{
+  quda::timeline::Scope scope("comms", "comm_allreduce_int");
+  allreduce(data, 1, [](int a, int b) { return a + b; });
+}
+
+void comm_allreduce_xor(uint64_t *data)
+{
+  allreduce(data, 1, [](uint64_t a, uint64_t b) { return a ^ b; });
+}
+
+/**  broadcast from rank 0 */
+void comm_broadcast(void *data, size_t nbytes)
+{
+  quda::timeline::Scope scope("comms", "comm_broadcast");
+  post_contribution(data);
+  if (rank != 0) memcpy(data, world->contribution[0], nbytes);
+  release_contributions();
+}
+
+void comm_gather_bytes(void *recv_buf, const size_t *recv_bytes, const void *send_buf, size_t send_bytes)
+{
+  quda::timeline::Scope scope("comms", "comm_gather_bytes");
+  post_contribution(send_buf);
+  if (rank == 0) {
+    size_t offset = 0;
+    for (int r = 0; r < world->size; r++) {
+      memcpy(static_cast<char *>(recv_buf) + offset, world->contribution[r], recv_bytes[r]);
+      offset += recv_bytes[r];
+    }
+  }
+  release_contributions();
+}
+
+void comm_abort_(int status) { exit(status); }
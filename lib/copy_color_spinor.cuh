@@ -12,6 +12,8 @@
 #include <color_spinor_field_order.h>
 #include <tune_quda.h>
 #include <utility> // for std::swap
+#include <type_traits>
+#include <algorithm>
 
 #define PRESERVE_SPINOR_NORM
 
@@ -33,6 +35,8 @@ namespace quda {
     using realIn = typename mapper<FloatIn>::type;
     static constexpr int nSpin = nSpin_;
     static constexpr int nColor = nColor_;
+    using OutOrder = Out;
+    using InOrder = In;
     Out out;
     const In in;
     const int volumeCB;
@@ -132,9 +136,63 @@ namespace quda {
     }
   };
 
-  /** CPU function to reorder spinor fields.  */
-  template <typename Arg, typename Basis> void copyColorSpinor(Arg &arg, const Basis &basis)
+  /**
+     @brief Describes the memory layout of a field order for the host
+     transpose engine.  Only orders whose elements can be addressed
+     directly, with no normalization, are supported (raw = true); the
+     rest go through the accessors.
+   */
+  template <typename Order> struct CopyLayout {
+    static constexpr bool raw = false;
+    static constexpr int N = 1;
+  };
+
+  /**
+     Space-spin-color order: each site is a contiguous run of 2*Ns*Nc reals
+   */
+  template <typename Float_, int Ns, int Nc> struct CopyLayout<SpaceSpinorColorOrder<Float_, Ns, Nc>> {
+    using Float = Float_;
+    static constexpr bool raw = true;
+    static constexpr int N = 2 * Ns * Nc;
+    static inline size_t index(const SpaceSpinorColorOrder<Float, Ns, Nc> &o, int parity, int x, int i)
+    {
+      return parity * o.offset + static_cast<size_t>(x) * N + i;
+    }
+  };
+
+  /**
+     Native order: the site is split into short vectors of N reals
+     strided by the field stride.  Fixed-point fields carry a norm
+     and so are not raw.
+   */
+  template <typename Float_, int Ns, int Nc, int N_, bool spin_project, bool huge_alloc>
+  struct CopyLayout<FloatNOrder<Float_, Ns, Nc, N_, spin_project, huge_alloc>> {
+    using Float = Float_;
+    static constexpr bool raw = !isFixed<Float>::value;
+    static constexpr int N = N_;
+    static inline size_t index(const FloatNOrder<Float, Ns, Nc, N_, spin_project, huge_alloc> &o, int parity, int x, int i)
+    {
+      return (parity * static_cast<size_t>(o.offset) + x + static_cast<size_t>(o.stride) * (i / N)) * N + i % N;
+    }
+  };
+
+  /**
+     @brief Number of sites per tile in the host transpose, chosen such
+     that a tile of the site-major side stays resident in L1 while its
+     short vectors are streamed out
+   */
+  template <typename Float, int length> constexpr int copy_cpu_tile()
   {
+    return 16384 / (length * sizeof(Float)) > 0 ? 16384 / (length * sizeof(Float)) : 1;
+  }
+
+  /**
+     CPU function to reorder spinor fields through the field accessors.
+     This handles basis changes and fixed-point fields.
+  */
+  template <typename Arg, typename Basis> void copyColorSpinor(Arg &arg, const Basis &basis, std::false_type)
+  {
+#pragma omp parallel for collapse(2)
     for (int parity = 0; parity<arg.nParity; parity++) {
       for (int x=0; x<arg.volumeCB; x++) {
         ColorSpinor<typename Arg::realIn, Arg::nColor, Arg::nSpin> in = arg.in(x, (parity+arg.inParity)&1);
@@ -145,6 +203,54 @@ namespace quda {
     }
   }
 
+  /**
+     CPU function to reorder spinor fields with no change of basis
+     between raw layouts.  Threads are assigned tiles of sites, and
+     within a tile we move one short vector at a time across all the
+     sites, so that both the reads and the writes are unit stride for
+     each inner loop, and the precision conversion vectorizes.
+  */
+  template <typename Arg, typename Basis> void copyColorSpinor(Arg &arg, const Basis &, std::true_type)
+  {
+    using OutLayout = CopyLayout<typename Arg::OutOrder>;
+    using InLayout = CopyLayout<typename Arg::InOrder>;
+    using FloatOut = typename OutLayout::Float;
+    using FloatIn = typename InLayout::Float;
+    constexpr int length = 2 * Arg::nSpin * Arg::nColor;
+    constexpr int N = OutLayout::N < InLayout::N ? OutLayout::N : InLayout::N;
+    constexpr int M = length / N;
+    constexpr int tile = copy_cpu_tile<FloatIn, length>();
+    const int n_tile = (arg.volumeCB + tile - 1) / tile;
+
+    FloatOut *out = arg.out.field;
+    const FloatIn *in = arg.in.field;
+
+#pragma omp parallel for collapse(2)
+    for (int parity = 0; parity < arg.nParity; parity++) {
+      for (int t = 0; t < n_tile; t++) {
+        const int out_parity = (parity + arg.outParity) & 1;
+        const int in_parity = (parity + arg.inParity) & 1;
+        const int x_end = std::min((t + 1) * tile, arg.volumeCB);
+        for (int m = 0; m < M; m++) {
+          for (int x = t * tile; x < x_end; x++) {
+            FloatOut *o = out + OutLayout::index(arg.out, out_parity, x, m * N);
+            const FloatIn *i = in + InLayout::index(arg.in, in_parity, x, m * N);
+#pragma omp simd
+            for (int j = 0; j < N; j++) o[j] = static_cast<FloatOut>(i[j]);
+          }
+        }
+      }
+    }
+  }
+
+  /** CPU function to reorder spinor fields.  */
+  template <typename Arg, typename Basis> void copyColorSpinor(Arg &arg, const Basis &basis)
+  {
+    constexpr bool raw = std::is_same<Basis, PreserveBasis<Arg>>::value && CopyLayout<typename Arg::OutOrder>::raw
+      && CopyLayout<typename Arg::InOrder>::raw;
+    copyColorSpinor(arg, basis, std::integral_constant<bool, raw>());
+  }
+
   /** CUDA kernel to reorder spinor fields.  Adopts a similar form as the CPU version, using the same inlined functions. */
   template <typename Arg, typename Basis> __global__ void copyColorSpinorKernel(Arg arg, Basis basis)
   {
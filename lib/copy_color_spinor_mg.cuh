@@ -20,6 +20,7 @@ namespace quda {
   /** CPU function to reorder spinor fields.  */
   template <typename FloatOut, typename FloatIn, int Ns, int Nc, typename OutOrder, typename InOrder>
     void packSpinor(OutOrder &outOrder, const InOrder &inOrder, int volume) {
+#pragma omp parallel for
     for (int x=0; x<volume; x++) {
       for (int s=0; s<Ns; s++) {
 	for (int c=0; c<Nc; c++) {
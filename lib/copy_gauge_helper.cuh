@@ -83,7 +83,11 @@ public:
       TuneParam tp = tuneLaunch(*this, getTuning(), getVerbosity());
       if (location == QUDA_CPU_FIELD_LOCATION) {
         if (!is_ghost) {
+#ifdef HOST_DEBUG
+          copyGauge<FloatOut, FloatIn, length, true>(arg);
+#else
           copyGauge<FloatOut, FloatIn, length>(arg);
+#endif
         } else {
           copyGhost<FloatOut, FloatIn, length>(arg);
         }
@@ -138,10 +142,6 @@ public:
     CopyGaugeArg<OutOrder,InOrder> arg(outOrder, inOrder, in);
     CopyGauge<FloatOut, FloatIn, length, CopyGaugeArg<OutOrder,InOrder> > gaugeCopier(arg, out, in, location);
 
-#ifdef HOST_DEBUG
-    if (location == QUDA_CPU_FIELD_LOCATION) checkNan<FloatIn, length>(arg);
-#endif
-
     // first copy body
     if (type == 0 || type == 2) {
       gaugeCopier.set_ghost(0);
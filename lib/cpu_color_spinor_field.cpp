@@ -1,7 +1,9 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <array>
 #include <iostream>
+#include <map>
 #include <typeinfo>
 #include <color_spinor_field.h>
 #include <comm_quda.h> // for comm_drand()
@@ -16,6 +18,24 @@ namespace quda {
 
   size_t cpuColorSpinorField::ghostFaceBytes[QUDA_MAX_DIM] = { };
 
+  /**
+     Persistent message handles for the halo exchange between the
+     static ghost buffers.  The message sizes depend on the field
+     geometry, nFace and precision, so one plan is cached per set of
+     message sizes, and reused until the ghost buffers are reallocated.
+  */
+  struct GhostExchangePlan {
+    MsgHandle *send_fwd[QUDA_MAX_DIM];
+    MsgHandle *send_back[QUDA_MAX_DIM];
+    MsgHandle *recv_fwd[QUDA_MAX_DIM];
+    MsgHandle *recv_back[QUDA_MAX_DIM];
+  };
+
+  // message size in bytes for each dimension, zero for dimensions that are not partitioned
+  using GhostExchangeKey = std::array<size_t, QUDA_MAX_DIM>;
+
+  static std::map<GhostExchangeKey, GhostExchangePlan> ghost_exchange_plans;
+
   cpuColorSpinorField::cpuColorSpinorField(const ColorSpinorParam &param) :
     ColorSpinorField(param), init(false), reference(false) {
 
@@ -147,10 +167,10 @@ namespace quda {
       // array of 4-d fields
       if (fieldOrder == QUDA_QOP_DOMAIN_WALL_FIELD_ORDER) {
         int Ls = x[nDim-1];
-        v = (void**)safe_malloc(Ls * sizeof(void*));
-        for (int i=0; i<Ls; i++) ((void**)v)[i] = safe_malloc(bytes / Ls);
+        v = (void**)pool_host_malloc(Ls * sizeof(void*));
+        for (int i=0; i<Ls; i++) ((void**)v)[i] = pool_host_malloc(bytes / Ls);
       } else {
-        v = safe_malloc(bytes);
+        v = pool_host_malloc(bytes);
       }
       init = true;
     }
@@ -187,8 +207,8 @@ namespace quda {
   
     if (init) {
       if (fieldOrder == QUDA_QOP_DOMAIN_WALL_FIELD_ORDER) 
-	for (int i=0; i<x[nDim-1]; i++) host_free(((void**)v)[i]);
-      host_free(v);
+	for (int i=0; i<x[nDim-1]; i++) pool_host_free(((void**)v)[i]);
+      pool_host_free(v);
       init = false;
     }
 
@@ -240,8 +260,16 @@ namespace quda {
   }
 
   void cpuColorSpinorField::zero() {
-    if (fieldOrder != QUDA_QOP_DOMAIN_WALL_FIELD_ORDER) memset(v, '\0', bytes);
-    else for (int i=0; i<x[nDim-1]; i++) memset(((void**)v)[i], '\0', bytes/x[nDim-1]);
+    if (fieldOrder != QUDA_QOP_DOMAIN_WALL_FIELD_ORDER) {
+      // zero with the same contiguous static partition used by the
+      // host blas kernels, so pages are first touched by the thread
+      // that will later stream them
+      constexpr size_t block = 4096;
+      const long n_block = (bytes + block - 1) / block;
+#pragma omp parallel for schedule(static)
+      for (long b = 0; b < n_block; b++)
+        memset(static_cast<char *>(v) + b * block, '\0', std::min(block, bytes - b * block));
+    } else for (int i=0; i<x[nDim-1]; i++) memset(((void**)v)[i], '\0', bytes/x[nDim-1]);
   }
 
   void cpuColorSpinorField::Source(QudaSourceType source_type, int x, int s, int c) {
@@ -272,10 +300,10 @@ namespace quda {
     if (!initGhostFaceBuffer || resize) {
       freeGhostBuffer();
       for (int i=0; i<nDimComms; i++) {
-	fwdGhostFaceBuffer[i] = safe_malloc(ghostFaceBytes[i]);
-	backGhostFaceBuffer[i] = safe_malloc(ghostFaceBytes[i]);
-	fwdGhostFaceSendBuffer[i] = safe_malloc(ghostFaceBytes[i]);
-	backGhostFaceSendBuffer[i] = safe_malloc(ghostFaceBytes[i]);
+	fwdGhostFaceBuffer[i] = pool_host_malloc(ghostFaceBytes[i]);
+	backGhostFaceBuffer[i] = pool_host_malloc(ghostFaceBytes[i]);
+	fwdGhostFaceSendBuffer[i] = pool_host_malloc(ghostFaceBytes[i]);
+	backGhostFaceSendBuffer[i] = pool_host_malloc(ghostFaceBytes[i]);
       }
       initGhostFaceBuffer = 1;
     }
@@ -286,11 +314,23 @@ namespace quda {
   {
     if(!initGhostFaceBuffer) return;
 
+    // the exchange plans refer to the ghost buffers so must go first
+    for (auto &entry : ghost_exchange_plans) {
+      GhostExchangePlan &plan = entry.second;
+      for (int i = 0; i < QUDA_MAX_DIM; i++) {
+        if (plan.send_fwd[i]) comm_free(plan.send_fwd[i]);
+        if (plan.send_back[i]) comm_free(plan.send_back[i]);
+        if (plan.recv_fwd[i]) comm_free(plan.recv_fwd[i]);
+        if (plan.recv_back[i]) comm_free(plan.recv_back[i]);
+      }
+    }
+    ghost_exchange_plans.clear();
+
     for(int i=0; i < 4; i++){  // make nDimComms static?
-      host_free(fwdGhostFaceBuffer[i]); fwdGhostFaceBuffer[i] = NULL;
-      host_free(backGhostFaceBuffer[i]); backGhostFaceBuffer[i] = NULL;
-      host_free(fwdGhostFaceSendBuffer[i]); fwdGhostFaceSendBuffer[i] = NULL;
-      host_free(backGhostFaceSendBuffer[i]);  backGhostFaceSendBuffer[i] = NULL;
+      pool_host_free(fwdGhostFaceBuffer[i]); fwdGhostFaceBuffer[i] = NULL;
+      pool_host_free(backGhostFaceBuffer[i]); backGhostFaceBuffer[i] = NULL;
+      pool_host_free(fwdGhostFaceSendBuffer[i]); fwdGhostFaceSendBuffer[i] = NULL;
+      pool_host_free(backGhostFaceSendBuffer[i]);  backGhostFaceSendBuffer[i] = NULL;
     } 
     initGhostFaceBuffer = 0;
   }
@@ -316,7 +356,7 @@ namespace quda {
     // allocate ghost buffer if not yet allocated
     allocateGhostBuffer(nFace);
 
-    void **sendbuf = static_cast<void**>(safe_malloc(nDimComms * 2 * sizeof(void*)));
+    void *sendbuf[2 * QUDA_MAX_DIM];
 
     for (int i=0; i<nDimComms; i++) {
       sendbuf[2*i + 0] = backGhostFaceSendBuffer[i];
@@ -325,11 +365,49 @@ namespace quda {
       ghost_buf[2*i + 1] = fwdGhostFaceBuffer[i];
     }
 
+    GhostExchangeKey bytes = {};
+    for (int i = 0; i < nDimComms; i++)
+      if (comm_dim_partitioned(i)) bytes[i] = siteSubset * nFace * surfaceCB[i] * 2 * nColor * nSpin * precision;
+
+    auto it = ghost_exchange_plans.find(bytes);
+    if (it == ghost_exchange_plans.end()) {
+      GhostExchangePlan plan = {};
+      for (int i = 0; i < nDimComms; i++) {
+        if (!comm_dim_partitioned(i)) continue;
+        plan.send_fwd[i] = comm_declare_send_relative(fwdGhostFaceSendBuffer[i], i, +1, bytes[i]);
+        plan.send_back[i] = comm_declare_send_relative(backGhostFaceSendBuffer[i], i, -1, bytes[i]);
+        plan.recv_fwd[i] = comm_declare_receive_relative(fwdGhostFaceBuffer[i], i, +1, bytes[i]);
+        plan.recv_back[i] = comm_declare_receive_relative(backGhostFaceBuffer[i], i, -1, bytes[i]);
+      }
+      it = ghost_exchange_plans.emplace(bytes, plan).first;
+    }
+    GhostExchangePlan &plan = it->second;
+
+    // post the receives in all dimensions before packing, so that
+    // messages can be received directly into the ghost buffers while
+    // the remaining faces are being packed and sent
+    for (int i = 0; i < nDimComms; i++) {
+      if (!comm_dim_partitioned(i)) continue;
+      comm_start(plan.recv_back[i]);
+      comm_start(plan.recv_fwd[i]);
+    }
+
     packGhost(sendbuf, parity, nFace, dagger);
 
-    exchange(ghost_buf, sendbuf, nFace);
+    for (int i = 0; i < nDimComms; i++) {
+      if (!comm_dim_partitioned(i)) continue;
+      comm_start(plan.send_fwd[i]);
+      comm_start(plan.send_back[i]);
+    }
 
-    host_free(sendbuf);
+    // the ghost zones are used in place, so there is no unpacking to do
+    for (int i = 0; i < nDimComms; i++) {
+      if (!comm_dim_partitioned(i)) continue;
+      comm_wait(plan.send_fwd[i]);
+      comm_wait(plan.send_back[i]);
+      comm_wait(plan.recv_back[i]);
+      comm_wait(plan.recv_fwd[i]);
+    }
   }
 
 } // namespace quda
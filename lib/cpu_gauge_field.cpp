@@ -185,7 +185,89 @@ namespace quda {
     for (int d=0; d<nDim; d++) host_free(recv[d]);
   }
 
-  void cpuGaugeField::exchangeExtendedGhost(const int *R, bool no_comms_fill) {
+  void cpuGaugeField::exchangeExtendedGhost(const int *R, bool no_comms_fill)
+  {
+    void *send[QUDA_MAX_DIM];
+    void *recv[QUDA_MAX_DIM];
+    size_t bytes[QUDA_MAX_DIM];
+    MsgHandle *mh_recv_back[QUDA_MAX_DIM];
+    MsgHandle *mh_recv_fwd[QUDA_MAX_DIM];
+    MsgHandle *mh_send_fwd[QUDA_MAX_DIM];
+    MsgHandle *mh_send_back[QUDA_MAX_DIM];
+
+    int dims[QUDA_MAX_DIM]; // the active dimensions in order
+    int n_dim = 0;
+    for (int d=0; d<nDim; d++) {
+      if (!(comm_dim_partitioned(d) || (no_comms_fill && R[d])) ) continue;
+      dims[n_dim++] = d;
+      // store both parities and directions in each
+      bytes[d] = surface[d] * R[d] * geometry * nInternal * precision;
+      send[d] = safe_malloc(2 * bytes[d]);
+      recv[d] = safe_malloc(2 * bytes[d]);
+
+      if (comm_dim_partitioned(d)) {
+        mh_recv_back[d] = comm_declare_receive_relative(recv[d], d, -1, bytes[d]);
+        mh_recv_fwd[d] = comm_declare_receive_relative(((char*)recv[d])+bytes[d], d, +1, bytes[d]);
+        mh_send_back[d] = comm_declare_send_relative(send[d], d, -1, bytes[d]);
+        mh_send_fwd[d] = comm_declare_send_relative(((char*)send[d])+bytes[d], d, +1, bytes[d]);
+
+        // the receives do not depend on any local data so post them all up front
+        comm_start(mh_recv_back[d]);
+        comm_start(mh_recv_fwd[d]);
+      }
+    }
+
+    if (n_dim > 0) extractExtendedGaugeGhost(*this, dims[0], R, send, true);
+
+    // The face sent in dimension j includes the halo of every lower
+    // dimension i, which is only valid once dimension i has been
+    // injected.  The part of the next face that lies in the interior of
+    // dimension i is independent of it however, so we extract this
+    // while the messages of dimension i are in flight, leaving only the
+    // thin slabs in the halo of dimension i on the critical path.
+    for (int n=0; n<n_dim; n++) {
+      const int d = dims[n];
+
+      if (comm_dim_partitioned(d)) {
+        comm_start(mh_send_fwd[d]);
+        comm_start(mh_send_back[d]);
+      } else {
+        memcpy(static_cast<char*>(recv[d])+bytes[d], send[d], bytes[d]);
+        memcpy(recv[d], static_cast<char*>(send[d])+bytes[d], bytes[d]);
+      }
+
+      if (n+1 < n_dim) extractExtendedGaugeGhost(*this, dims[n+1], R, send, true, d, R[d], x[d] - R[d]);
+
+      if (comm_dim_partitioned(d)) {
+        comm_wait(mh_send_fwd[d]);
+        comm_wait(mh_send_back[d]);
+        comm_wait(mh_recv_back[d]);
+        comm_wait(mh_recv_fwd[d]);
+      }
+
+      // inject back into the gauge field
+      extractExtendedGaugeGhost(*this, d, R, recv, false);
+
+      if (n+1 < n_dim) {
+        extractExtendedGaugeGhost(*this, dims[n+1], R, send, true, d, 0, R[d]);
+        extractExtendedGaugeGhost(*this, dims[n+1], R, send, true, d, x[d] - R[d], x[d]);
+      }
+    }
+
+    for (int n=0; n<n_dim; n++) {
+      const int d = dims[n];
+      if (comm_dim_partitioned(d)) {
+        comm_free(mh_send_fwd[d]);
+        comm_free(mh_send_back[d]);
+        comm_free(mh_recv_back[d]);
+        comm_free(mh_recv_fwd[d]);
+      }
+      host_free(send[d]);
+      host_free(recv[d]);
+    }
+  }
+
+  void cpuGaugeField::exchangeExtendedGhostSerial(const int *R, bool no_comms_fill) {
     
     void *send[QUDA_MAX_DIM];
     void *recv[QUDA_MAX_DIM];
@@ -526,11 +526,15 @@ namespace quda {
     }
   }
 
-  void cudaGaugeField::copy(const GaugeField &src) {
+  void cudaGaugeField::copy(const GaugeField &src) { copy(src, nullptr); }
+
+  void cudaGaugeField::copy(const GaugeField &src, TimeProfile *profile) {
     if (this == &src) return;
 
     checkField(src);
 
+    if (profile) profile->TPSTART(QUDA_PROFILE_H2D);
+
     if (link_type == QUDA_ASQTAD_FAT_LINKS) {
       fat_link_max = src.LinkMax();
       if (fat_link_max == 0.0 && precision < QUDA_SINGLE_PRECISION) fat_link_max = src.abs_max();
@@ -555,6 +559,11 @@ namespace quda {
       if (reorder_location() == QUDA_CPU_FIELD_LOCATION) { // do reorder on the CPU
 	void *buffer = pool_pinned_malloc(bytes);
 
+        if (profile) {
+          profile->TPSTOP(QUDA_PROFILE_H2D);
+          profile->TPSTART(QUDA_PROFILE_HOST_REORDER);
+        }
+
 	if (ghostExchange != QUDA_GHOST_EXCHANGE_EXTENDED && src.GhostExchange() != QUDA_GHOST_EXCHANGE_EXTENDED) {
 	  // copy field and ghost zone into buffer
 	  copyGenericGauge(*this, src, QUDA_CPU_FIELD_LOCATION, buffer, static_cast<const cpuGaugeField&>(src).gauge);
@@ -567,6 +576,11 @@ namespace quda {
           if (geometry == QUDA_COARSE_GEOMETRY) errorQuda("Extended gauge copy for coarse geometry not supported");
 	}
 
+        if (profile) {
+          profile->TPSTOP(QUDA_PROFILE_HOST_REORDER);
+          profile->TPSTART(QUDA_PROFILE_H2D);
+        }
+
 	// this copies over both even and odd
         qudaMemcpy(gauge, buffer, bytes, cudaMemcpyDefault);
         pool_pinned_free(buffer);
@@ -630,6 +644,8 @@ namespace quda {
 
     qudaDeviceSynchronize(); // include sync here for accurate host-device profiling
     checkCudaError();
+
+    if (profile) profile->TPSTOP(QUDA_PROFILE_H2D);
   }
 
   void cudaGaugeField::loadCPUField(const cpuGaugeField &cpu) {
@@ -639,9 +655,7 @@ namespace quda {
   }
 
   void cudaGaugeField::loadCPUField(const cpuGaugeField &cpu, TimeProfile &profile) {
-    profile.TPSTART(QUDA_PROFILE_H2D);
-    loadCPUField(cpu);
-    profile.TPSTOP(QUDA_PROFILE_H2D);
+    copy(cpu, &profile);
   }
 
   void cudaGaugeField::saveCPUField(cpuGaugeField &cpu) const
@@ -106,7 +106,9 @@ namespace quda {
       for (int dir = 0; dir<2; dir++) {
 
 	int D0 = extract ? dir*arg.X[dim] + (1-dir)*arg.R[dim] : dir*(arg.X[dim] + arg.R[dim]); 
-	  
+
+	// each (d,a,b,c,g) maps to a distinct site and buffer element
+#pragma omp parallel for collapse(2)
 	for (int d=D0; d<D0+arg.R[dim]; d++) {
 	  for (int a=arg.A0[dim]; a<arg.A1[dim]; a++) { // loop over the interior surface
 	    for (int b=arg.B0[dim]; b<arg.B1[dim]; b++) { // loop over the interior surface
@@ -205,7 +207,7 @@ namespace quda {
 
   public:
     ExtractGhostEx(ExtractGhostExArg<Order,nDim,dim> &arg, bool extract, 
-		   const GaugeField &meta, QudaFieldLocation location)
+		   const GaugeField &meta, QudaFieldLocation location, int split_dim = -1)
       : arg(arg), extract(extract), meta(meta), location(location) {
       int dA = arg.A1[dim]-arg.A0[dim];
       int dB = arg.B1[dim]-arg.B0[dim];
@@ -213,6 +215,12 @@ namespace quda {
       size = arg.R[dim]*dA*dB*dC*arg.order.geometry;
       writeAuxString("prec=%lu,stride=%d,extract=%d,dimension=%d,geometry=%d",
 		     sizeof(Float),arg.order.stride, extract, dim, arg.order.geometry);
+      if (split_dim >= 0) {
+        char split[TuneKey::aux_n / 2];
+        snprintf(split, TuneKey::aux_n / 2, ",split=%d,a=%d-%d,b=%d-%d,c=%d-%d", split_dim, arg.A0[dim], arg.A1[dim],
+                 arg.B0[dim], arg.B1[dim], arg.C0[dim], arg.C1[dim]);
+        strncat(aux, split, TuneKey::aux_n - strlen(aux) - 1);
+      }
     }
   
     void apply(const qudaStream_t &stream) {
@@ -252,10 +260,14 @@ namespace quda {
      @param E the extended gauge dimensions
      @param R array holding the radius of the extended region 
      @param extract Whether we are extracting or injecting the ghost zone
+     @param split_dim If non-negative, restrict to the part of the face
+     whose extended coordinate in dimension split_dim < dim lies in
+     [split_begin, split_end)
   */
   template <typename Float, int length, typename Order>
   void extractGhostEx(Order order, const int dim, const int *surfaceCB, const int *E, 
-		      const int *R, bool extract, const GaugeField &u, QudaFieldLocation location) {
+		      const int *R, bool extract, const GaugeField &u, QudaFieldLocation location,
+		      int split_dim, int split_begin, int split_end) {
     const int nDim = 4;
     //loop variables: a, b, c with a the most signifcant and c the least significant
     //A0, B0, C0 the minimum value
@@ -274,6 +286,17 @@ namespace quda {
     int C0[nDim] = {R[1],      0,           0,            0};
     int C1[nDim] = {X[1]+R[1], X[0]+2*R[0], X[0]+2*R[0],  X[0]+2*R[0]};
 
+    if (split_dim >= 0) {
+      if (split_dim >= dim) errorQuda("Invalid split dimension %d for dim=%d", split_dim, dim);
+      // dimensions lower than dim span their full extended range, with
+      // c, b, a the loop variables for dimensions 0, 1, 2 respectively
+      int *begin = split_dim == 0 ? C0 : split_dim == 1 ? B0 : A0;
+      int *end = split_dim == 0 ? C1 : split_dim == 1 ? B1 : A1;
+      begin[dim] = split_begin;
+      end[dim] = split_end;
+      if (split_end <= split_begin) return;
+    }
+
     int fSrc[nDim][nDim] = {
       {E[2]*E[1]*E[0], E[1]*E[0], E[0],              1},
       {E[2]*E[1]*E[0], E[1]*E[0],    1,           E[0]},
@@ -300,22 +323,22 @@ namespace quda {
     if (dim==0) {
       ExtractGhostExArg<Order,nDim,0> arg(order, X, R, surfaceCB, A0, A1, B0, B1, 
 					  C0, C1, fSrc, fBuf, localParity);
-      ExtractGhostEx<Float,length,nDim,0,Order> extractor(arg, extract, u, location);
+      ExtractGhostEx<Float,length,nDim,0,Order> extractor(arg, extract, u, location, split_dim);
       extractor.apply(0);
     } else if (dim==1) {
       ExtractGhostExArg<Order,nDim,1> arg(order, X, R, surfaceCB, A0, A1, B0, B1, 
 					  C0, C1, fSrc, fBuf, localParity);
-      ExtractGhostEx<Float,length,nDim,1,Order> extractor(arg, extract, u, location);
+      ExtractGhostEx<Float,length,nDim,1,Order> extractor(arg, extract, u, location, split_dim);
       extractor.apply(0);
     } else if (dim==2) {
       ExtractGhostExArg<Order,nDim,2> arg(order, X, R, surfaceCB, A0, A1, B0, B1, 
 					  C0, C1, fSrc, fBuf, localParity);
-      ExtractGhostEx<Float,length,nDim,2,Order> extractor(arg, extract, u, location);
+      ExtractGhostEx<Float,length,nDim,2,Order> extractor(arg, extract, u, location, split_dim);
       extractor.apply(0);
     } else if (dim==3) {
       ExtractGhostExArg<Order,nDim,3> arg(order, X, R, surfaceCB, A0, A1, B0, B1, 
 					  C0, C1, fSrc, fBuf, localParity);
-      ExtractGhostEx<Float,length,nDim,3,Order> extractor(arg, extract, u, location);
+      ExtractGhostEx<Float,length,nDim,3,Order> extractor(arg, extract, u, location, split_dim);
       extractor.apply(0);
     } else {
       errorQuda("Invalid dim=%d", dim);
@@ -326,7 +349,9 @@ namespace quda {
 
   /** This is the template driver for extractGhost */
   template <typename Float>
-  void extractGhostEx(const GaugeField &u, int dim, const int *R, Float **Ghost, bool extract) {
+  void extractGhostEx(const GaugeField &u, int dim, const int *R, Float **Ghost, bool extract, int split_dim,
+                      int split_begin, int split_end)
+  {
 
     const int length = 18;
 
@@ -336,12 +361,12 @@ namespace quda {
     if (u.isNative()) {
       if (u.Reconstruct() == QUDA_RECONSTRUCT_NO) {
         typedef typename gauge_mapper<Float, QUDA_RECONSTRUCT_NO>::type G;
-        extractGhostEx<Float, length>(G(u, 0, Ghost), dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+        extractGhostEx<Float, length>(G(u, 0, Ghost), dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_begin, split_end);
       } else if (u.Reconstruct() == QUDA_RECONSTRUCT_12) {
 #if QUDA_RECONSTRUCT & 2
 	typedef typename gauge_mapper<Float,QUDA_RECONSTRUCT_12>::type G;
 	extractGhostEx<Float,length>(G(u, 0, Ghost),
-				     dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+				     dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_begin, split_end);
 #else
         errorQuda("QUDA_RECONSTRUCT = %d does not enable QUDA_RECONSTRUCT_12", QUDA_RECONSTRUCT);
 #endif
@@ -349,7 +374,7 @@ namespace quda {
 #if QUDA_RECONSTRUCT & 1
 	typedef typename gauge_mapper<Float,QUDA_RECONSTRUCT_8>::type G;
 	extractGhostEx<Float,length>(G(u, 0, Ghost), 
-				     dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+				     dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_begin, split_end);
 #else
         errorQuda("QUDA_RECONSTRUCT = %d does not enable QUDA_RECONSTRUCT_8", QUDA_RECONSTRUCT);
 #endif
@@ -357,7 +382,7 @@ namespace quda {
 #if QUDA_RECONSTRUCT & 2
 	typedef typename gauge_mapper<Float,QUDA_RECONSTRUCT_13>::type G;
 	extractGhostEx<Float,length>(G(u, 0, Ghost),
-				     dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+				     dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_begin, split_end);
 #else
         errorQuda("QUDA_RECONSTRUCT = %d does not enable QUDA_RECONSTRUCT_13", QUDA_RECONSTRUCT);
 #endif
@@ -365,7 +390,7 @@ namespace quda {
 #if QUDA_RECONSTRUCT & 1
 	typedef typename gauge_mapper<Float,QUDA_RECONSTRUCT_9>::type G;
 	extractGhostEx<Float,length>(G(u, 0, Ghost),
-				     dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+				     dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_begin, split_end);
 #else
         errorQuda("QUDA_RECONSTRUCT = %d does not enable QUDA_RECONSTRUCT_9", QUDA_RECONSTRUCT);
 #endif
@@ -374,7 +399,7 @@ namespace quda {
       
 #ifdef BUILD_QDP_INTERFACE
       extractGhostEx<Float,length>(QDPOrder<Float,length>(u, 0, Ghost),
-				   dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+				   dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_begin, split_end);
 #else
       errorQuda("QDP interface has not been built\n");
 #endif
@@ -383,7 +408,7 @@ namespace quda {
 
 #ifdef BUILD_QDPJIT_INTERFACE
       extractGhostEx<Float,length>(QDPJITOrder<Float,length>(u, 0, Ghost),
-				   dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+				   dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_begin, split_end);
 #else
       errorQuda("QDPJIT interface has not been built\n");
 #endif
@@ -392,7 +417,7 @@ namespace quda {
 
 #ifdef BUILD_CPS_INTERFACE
       extractGhostEx<Float,length>(CPSOrder<Float,length>(u, 0, Ghost),
-				   dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+				   dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_begin, split_end);
 #else
       errorQuda("CPS interface has not been built\n");
 #endif
@@ -401,7 +426,7 @@ namespace quda {
 
 #ifdef BUILD_MILC_INTERFACE
       extractGhostEx<Float,length>(MILCOrder<Float,length>(u, 0, Ghost),
-				   dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+				   dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_begin, split_end);
 #else
       errorQuda("MILC interface has not been built\n");
 #endif
@@ -410,7 +435,7 @@ namespace quda {
 
 #ifdef BUILD_BQCD_INTERFACE
       extractGhostEx<Float,length>(BQCDOrder<Float,length>(u, 0, Ghost),
-				   dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+				   dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_begin, split_end);
 #else
       errorQuda("BQCD interface has not been built\n");
 #endif
@@ -419,7 +444,7 @@ namespace quda {
 
 #ifdef BUILD_TIFR_INTERFACE
       extractGhostEx<Float,length>(TIFROrder<Float,length>(u, 0, Ghost),
-				   dim, u.SurfaceCB(), u.X(), R, extract, u, location);
+				   dim, u.SurfaceCB(), u.X(), R, extract, u, location, split_dim, split_begin, split_end);
 #else
       errorQuda("TIFR interface has not been built\n");
 #endif
@@ -430,26 +455,27 @@ namespace quda {
 
   }
 
-  void extractExtendedGaugeGhost(const GaugeField &u, int dim, const int *R, 
-				 void **ghost, bool extract) {
+  void extractExtendedGaugeGhost(const GaugeField &u, int dim, const int *R, void **ghost, bool extract, int split_dim,
+                                 int split_begin, int split_end)
+  {
 
     if (u.Precision() == QUDA_DOUBLE_PRECISION) {
-      extractGhostEx(u, dim, R, (double**)ghost, extract);
+      extractGhostEx(u, dim, R, (double**)ghost, extract, split_dim, split_begin, split_end);
     } else if (u.Precision() == QUDA_SINGLE_PRECISION) {
 #if QUDA_PRECISION & 4
-      extractGhostEx(u, dim, R, (float**)ghost, extract);
+      extractGhostEx(u, dim, R, (float**)ghost, extract, split_dim, split_begin, split_end);
 #else
       errorQuda("QUDA_PRECISION=%d does not enable single precision", QUDA_PRECISION);
 #endif
     } else if (u.Precision() == QUDA_HALF_PRECISION) {
 #if QUDA_PRECISION & 2
-      extractGhostEx(u, dim, R, (short **)ghost, extract);
+      extractGhostEx(u, dim, R, (short **)ghost, extract, split_dim, split_begin, split_end);
 #else
       errorQuda("QUDA_PRECISION=%d does not enable half precision", QUDA_PRECISION);
 #endif
     } else if (u.Precision() == QUDA_QUARTER_PRECISION) {
 #if QUDA_PRECISION & 1
-      extractGhostEx(u, dim, R, (char **)ghost, extract);
+      extractGhostEx(u, dim, R, (char **)ghost, extract, split_dim, split_begin, split_end);
 #else
       errorQuda("QUDA_PRECISION=%d does not enable half precision", QUDA_PRECISION);
 #endif
@@ -397,7 +397,7 @@ static void initMPIComms(void)
 }
 #endif
 
-static bool comms_initialized = false;
+static QUDA_RANK_LOCAL bool comms_initialized = false;
 
 void initCommsGridQuda(int nDim, const int *dims, QudaCommsMap func, void *fdata)
 {
@@ -433,12 +433,18 @@ void initCommsGridQuda(int nDim, const int *dims, QudaCommsMap func, void *fdata
       warningQuda("QMP logical topology is undeclared; using default lexicographical ordering");
 #endif
 
-      map_data.ndim = nDim;
-      for (int i=0; i<nDim; i++) {
-        map_data.dims[i] = dims[i];
+      char *node_rank_map_env = getenv("QUDA_ENABLE_NODE_RANK_MAP");
+      if (node_rank_map_env && strcmp(node_rank_map_env, "1") == 0) {
+        fdata = nullptr;
+        func = comm_rank_from_coords_node_local;
+      } else {
+        map_data.ndim = nDim;
+        for (int i=0; i<nDim; i++) {
+          map_data.dims[i] = dims[i];
+        }
+        fdata = (void *) &map_data;
+        func = lex_rank_from_coords;
       }
-      fdata = (void *) &map_data;
-      func = lex_rank_from_coords;
 
 #if QMP_COMMS
     }
@@ -463,6 +469,8 @@ static void init_default_comms()
   }
 #elif defined(MPI_COMMS)
   errorQuda("When using MPI for communications, initCommsGridQuda() must be called before initQuda()");
+#elif defined(THREAD_COMMS)
+  errorQuda("When using threaded communications, initCommsGridQuda() must be called before initQuda()");
 #else // single-GPU
   const int dims[4] = {1, 1, 1, 1};
   initCommsGridQuda(4, dims, nullptr, nullptr);
@@ -483,6 +491,12 @@ extern char* gitversion;
  */
 void initQudaDevice(int dev) {
 
+#ifdef THREAD_COMMS
+  // the rank threads would share, and race on, everything initQuda sets up
+  if (comms_initialized && comm_size() > 1)
+    errorQuda("initQuda is not supported with more than one rank of the threaded communications backend");
+#endif
+
   //static bool initialized = false;
   if (initialized) return;
   initialized = true;
@@ -666,6 +680,9 @@ void initQudaMemory()
 
   loadTuneCache();
 
+  // solves in the telemetry are counted from initQuda
+  resetSolverTelemetry();
+
   for (int d=0; d<4; d++) R[d] = 2 * (redundant_comms || commDimPartitioned(d));
 
   profileInit.TPSTOP(QUDA_PROFILE_INIT);
@@ -779,9 +796,7 @@ void loadGaugeQuda(void *h_gauge, QudaGaugeParam *param)
     profileGauge.TPSTOP(QUDA_PROFILE_INIT);
   } else {
     profileGauge.TPSTOP(QUDA_PROFILE_INIT);
-    profileGauge.TPSTART(QUDA_PROFILE_H2D);
-    precise->copy(*in);
-    profileGauge.TPSTOP(QUDA_PROFILE_H2D);
+    precise->copy(*in, &profileGauge);
   }
 
   // for gaugeSmeared we are interested only in the precise version
@@ -1436,6 +1451,12 @@ void flushChronoQuda(int i)
   basis.clear();
 }
 
+int getSolverTelemetryQuda(QudaSolverTelemetryRecord *records, int n) { return getSolverTelemetry(records, n); }
+
+void saveSolverTelemetryQuda(const char *filename) { saveSolverTelemetry(filename); }
+
+void flushSolverTelemetryQuda() { flushSolverTelemetry(); }
+
 void endQuda(void)
 {
   profileEnd.TPSTART(QUDA_PROFILE_TOTAL);
@@ -1460,6 +1481,7 @@ void endQuda(void)
 
   pool::flush_pinned();
   pool::flush_device();
+  pool::flush_host();
 
   host_free(num_failures_h);
   num_failures_h = nullptr;
@@ -1474,6 +1496,8 @@ void endQuda(void)
 
   saveTuneCache();
   saveProfile();
+  endTrace();
+  timeline::save(comm_rank());
 
   // flush any outstanding force monitoring (if enabled)
   flushForceMonitor();
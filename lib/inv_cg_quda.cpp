@@ -459,6 +459,7 @@ namespace quda {
     int j = 0;
 
     PrintStats("CG", k, r2, b2, heavy_quark_res);
+    RecordTelemetry(k, r2, heavy_quark_res);
 
     int steps_since_reliable = 1;
     bool converged = convergence(r2, heavy_quark_res, stop, param.tol_hq);
@@ -703,6 +704,7 @@ namespace quda {
         steps_since_reliable = 0;
         r0Norm = sqrt(r2);
         rUpdate++;
+        RecordTelemetry(k + 1, r2, heavy_quark_res, true);
 
         heavy_quark_res_old = heavy_quark_res;
       }
@@ -711,6 +713,7 @@ namespace quda {
       k++;
 
       PrintStats("CG", k, r2, b2, heavy_quark_res);
+      RecordTelemetry(k, r2, heavy_quark_res);
       // check convergence, if convergence is satisfied we only need to check that we had a reliable update for the heavy quarks recently
       converged = convergence(r2, heavy_quark_res, stop, param.tol_hq);
 
@@ -396,6 +396,7 @@ namespace quda {
     int k_break = 0;
 
     PrintStats("GCR", total_iter+k, r2, b2, heavy_quark_res);
+    RecordTelemetry(total_iter + k, r2, heavy_quark_res);
     while ( !convergence(r2, heavy_quark_res, stop, param.tol_hq) && total_iter < param.maxiter) {
 
       if (K) {
@@ -435,6 +436,7 @@ namespace quda {
       total_iter++;
 
       PrintStats("GCR", total_iter, r2, b2, heavy_quark_res);
+      RecordTelemetry(total_iter, r2, heavy_quark_res);
 
       // update since n_krylov or maxiter reached, converged or reliable update required
       // note that the heavy quark residual will by definition only be checked every n_krylov steps
@@ -459,6 +461,7 @@ namespace quda {
         }
 
         if (use_heavy_quark_res) heavy_quark_res = sqrt(blas::HeavyQuarkResidualNorm(x, r).z);
+        RecordTelemetry(total_iter, r2, heavy_quark_res, true);
 
         // break-out check if we have reached the limit of the precision
         if (r2 > r2_old) {
@@ -0,0 +1,340 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include <quda_internal.h>
+#include <blas_quda.h>
+#include <dslash_quda.h>
+#include <invert_quda.h>
+#include <util_quda.h>
+
+/**
+   @file inv_pipelined_cg_quda.cpp
+
+   Pipelined CG, following P. Ghysels and W. Vanroose, "Hiding global
+   synchronization latency in the preconditioned Conjugate Gradient
+   algorithm", Parallel Computing 40 (2014) 224.  Alongside the usual
+   CG vectors (x, r, p) we carry w = A r, s = A p and z = A s through
+   recurrences, so that gamma = (r, r) and delta = (w, r) can be
+   computed in a single reduction before the matrix-vector product
+   q = A w, which they are independent of.  The global sum of the
+   reduction is then overlapped with the matrix-vector product.
+*/
+
+namespace quda {
+
+  PipelinedCG::PipelinedCG(const DiracMatrix &mat, const DiracMatrix &matSloppy, const DiracMatrix &matPrecon,
+                           SolverParam &param, TimeProfile &profile) :
+    Solver(mat, matSloppy, matPrecon, param, profile),
+    init(false)
+  {
+  }
+
+  PipelinedCG::~PipelinedCG()
+  {
+    if (init) {
+      delete rp;
+      delete yp;
+      delete tmpp;
+      delete wSp;
+      delete pSp;
+      delete sSp;
+      delete zSp;
+      delete qSp;
+      if (param.precision != param.precision_sloppy) {
+        delete rSp;
+        delete xSp;
+        delete tmpSp;
+      }
+      if (!mat.isStaggered()) delete tmp2Sp;
+
+      init = false;
+    }
+  }
+
+  double PipelinedCG::replaceResidual(ColorSpinorField &x, ColorSpinorField &b)
+  {
+    const bool mixed_precision = (param.precision != param.precision_sloppy);
+    ColorSpinorField &r = *rp;
+    ColorSpinorField &y = *yp;
+    ColorSpinorField &tmp = *tmpp;
+    ColorSpinorField &rS = *rSp;
+    ColorSpinorField &xS = *xSp;
+    ColorSpinorField &tmpS = *tmpSp;
+    ColorSpinorField &tmp2S = *tmp2Sp;
+
+    double r2;
+    if (mixed_precision) {
+      // accumulate the sloppy solution into y (here we can use x as tmp)
+      blas::copy(x, xS);
+      blas::xpy(x, y);
+      mat(r, y, x, tmp);
+      r2 = blas::xmyNorm(b, r);
+      blas::copy(rS, r);
+      blas::zero(xS);
+    } else {
+      mat(r, x, y, tmp);
+      r2 = blas::xmyNorm(b, r);
+    }
+
+    matSloppy(*wSp, rS, tmpS, tmp2S);
+    matSloppy(*sSp, *pSp, tmpS, tmp2S);
+    matSloppy(*zSp, *sSp, tmpS, tmp2S);
+
+    return r2;
+  }
+
+  void PipelinedCG::operator()(ColorSpinorField &x, ColorSpinorField &b)
+  {
+    if (x.Precision() != param.precision || b.Precision() != param.precision) errorQuda("Precision mismatch");
+    if (param.residual_type & QUDA_HEAVY_QUARK_RESIDUAL)
+      errorQuda("Heavy-quark residual not supported by the pipelined CG solver");
+    if (param.deflate) errorQuda("Deflation not supported by the pipelined CG solver");
+
+    profile.TPSTART(QUDA_PROFILE_INIT);
+
+    // Check to see that we're not trying to invert on a zero-field source
+    double b2 = blas::norm2(b);
+    if (b2 == 0 && param.compute_null_vector == QUDA_COMPUTE_NULL_VECTOR_NO) {
+      profile.TPSTOP(QUDA_PROFILE_INIT);
+      printfQuda("Warning: inverting on zero-field source\n");
+      x = b;
+      param.true_res = 0.0;
+      param.true_res_hq = 0.0;
+      return;
+    }
+
+    const bool mixed_precision = (param.precision != param.precision_sloppy);
+    if (!init) {
+      ColorSpinorParam csParam(x);
+      csParam.create = QUDA_ZERO_FIELD_CREATE;
+      rp = ColorSpinorField::Create(csParam);
+      yp = ColorSpinorField::Create(csParam);
+      tmpp = ColorSpinorField::Create(csParam);
+
+      // sloppy fields
+      csParam.setPrecision(param.precision_sloppy);
+      wSp = ColorSpinorField::Create(csParam);
+      pSp = ColorSpinorField::Create(csParam);
+      sSp = ColorSpinorField::Create(csParam);
+      zSp = ColorSpinorField::Create(csParam);
+      qSp = ColorSpinorField::Create(csParam);
+      if (mixed_precision) {
+        rSp = ColorSpinorField::Create(csParam);
+        xSp = ColorSpinorField::Create(csParam);
+        tmpSp = ColorSpinorField::Create(csParam);
+      } else {
+        rSp = rp;
+        tmpSp = tmpp;
+      }
+      tmp2Sp = !mat.isStaggered() ? ColorSpinorField::Create(csParam) : tmpSp;
+
+      init = true;
+    }
+    // without mixed precision the solution is accumulated directly
+    if (!mixed_precision) xSp = &x;
+
+    ColorSpinorField &r = *rp;
+    ColorSpinorField &y = *yp;
+    ColorSpinorField &tmp = *tmpp;
+    ColorSpinorField &rS = *rSp;
+    ColorSpinorField &xS = *xSp;
+    ColorSpinorField &wS = *wSp;
+    ColorSpinorField &pS = *pSp;
+    ColorSpinorField &sS = *sSp;
+    ColorSpinorField &zS = *zSp;
+    ColorSpinorField &qS = *qSp;
+    ColorSpinorField &tmpS = *tmpSp;
+    ColorSpinorField &tmp2S = *tmp2Sp;
+
+    // this parameter determines how many consective residual
+    // replacements with an increasing residual we tolerate before
+    // terminating the solver, i.e., how long do we want to keep
+    // trying to converge
+    const int maxResIncrease = param.max_res_increase;
+    const int maxResIncreaseTotal = param.max_res_increase_total;
+    int resIncrease = 0;
+    int resIncreaseTotal = 0;
+
+    profile.TPSTOP(QUDA_PROFILE_INIT);
+    profile.TPSTART(QUDA_PROFILE_PREAMBLE);
+
+    blas::flops = 0;
+
+    // compute initial residual depending on whether we have an initial guess or not
+    double r2;
+    if (param.use_init_guess == QUDA_USE_INIT_GUESS_YES) {
+      mat(r, x, y, tmp);
+      r2 = blas::xmyNorm(b, r);
+      if (b2 == 0) b2 = r2;
+      if (mixed_precision) {
+        blas::copy(y, x);
+        blas::zero(xS);
+      }
+    } else {
+      blas::copy(r, b);
+      r2 = b2;
+      blas::zero(x);
+      if (mixed_precision) {
+        blas::zero(y);
+        blas::zero(xS);
+      }
+    }
+    if (mixed_precision) blas::copy(rS, r);
+
+    // for a null-vector solve b2 is only set by the initial residual, so this must follow it
+    double stop = stopping(param.tol, b2, param.residual_type); // stopping condition of solver
+
+    // the search direction and its images start from zero, so that the first iteration is a steepest-descent step
+    blas::zero(pS);
+    blas::zero(sS);
+    blas::zero(zS);
+    matSloppy(wS, rS, tmpS, tmp2S);
+
+    profile.TPSTOP(QUDA_PROFILE_PREAMBLE);
+    if (convergence(r2, 0.0, stop, param.tol_hq)) {
+      if (param.preserve_source == QUDA_PRESERVE_SOURCE_NO) blas::copy(b, r);
+      return;
+    }
+    profile.TPSTART(QUDA_PROFILE_COMPUTE);
+
+    double rNorm = sqrt(r2);
+    double r0Norm = rNorm; // residual norm at the last replacement
+    double maxrr = rNorm;
+    const double replace_delta = param.delta;
+    int rUpdate = 0;
+
+    double gamma = r2;
+    double alpha = 0.0;
+    bool replaced = true; // whether r was just set to the true residual
+
+    int k = 0;
+    PrintStats("PipelinedCG", k, r2, b2, 0.0);
+    RecordTelemetry(k, r2, 0.0);
+
+    while (k < param.maxiter) {
+
+      // the local parts of gamma = (r,r) and delta = (w,r) in a single reduction kernel
+      double reduction[2];
+      {
+        const bool global_reduction = commGlobalReduction();
+        commGlobalReductionSet(false);
+        double3 rw = blas::cDotProductNormA(rS, wS);
+        commGlobalReductionSet(global_reduction);
+        reduction[0] = rw.z;
+        reduction[1] = rw.x;
+      }
+
+      // the global sum is overlapped with q = A w
+      ReduceHandle *rh = reduceDoubleArrayStart(reduction, 2);
+      matSloppy(qS, wS, tmpS, tmp2S);
+      reduceWait(rh);
+
+      const double gamma_old = gamma;
+      gamma = reduction[0];
+      const double rw = reduction[1];
+
+      r2 = gamma;
+      rNorm = sqrt(r2);
+      if (rNorm > maxrr) maxrr = rNorm;
+
+      // the residual norm of the last update is only known now
+      if (!replaced) {
+        PrintStats("PipelinedCG", k, r2, b2, 0.0);
+        RecordTelemetry(k, r2, 0.0);
+      }
+
+      const bool converged = convergence(r2, 0.0, stop, param.tol_hq);
+      if (converged && replaced) break;
+
+      // replace the residual if it has dropped by delta, and always before we declare convergence
+      if (!replaced && (converged || rNorm < replace_delta * maxrr)) {
+        r2 = replaceResidual(x, b);
+        rNorm = sqrt(r2);
+        param.true_res = sqrt(r2 / b2);
+        rUpdate++;
+        RecordTelemetry(k, r2, 0.0, true);
+
+        // break-out check if we have reached the limit of the precision
+        if (rNorm > r0Norm) {
+          resIncrease++;
+          resIncreaseTotal++;
+          warningQuda("PipelinedCG: new replaced residual norm %e is greater than previous replaced residual norm "
+                      "%e (total #inc %i)",
+                      rNorm, r0Norm, resIncreaseTotal);
+          if (resIncrease > maxResIncrease or resIncreaseTotal > maxResIncreaseTotal) {
+            warningQuda("PipelinedCG: solver exiting due to too many true residual norm increases");
+            break;
+          }
+        } else {
+          resIncrease = 0;
+        }
+
+        r0Norm = rNorm;
+        maxrr = rNorm;
+        replaced = true;
+
+        // gamma and delta are recomputed from the replaced vectors, while the
+        // recurrence coefficients continue from the previous iteration
+        gamma = gamma_old;
+        continue;
+      }
+
+      double beta;
+      if (k == 0) {
+        beta = 0.0;
+        alpha = gamma / rw;
+      } else {
+        beta = gamma / gamma_old;
+        alpha = gamma / (rw - beta * gamma / alpha);
+      }
+
+      blas::xpay(qS, beta, zS); // z = q + beta z
+      blas::xpay(wS, beta, sS); // s = w + beta s
+      blas::xpay(rS, beta, pS); // p = r + beta p
+      blas::axpy(alpha, pS, xS);
+      blas::axpy(-alpha, sS, rS);
+      blas::axpy(-alpha, zS, wS);
+      replaced = false;
+
+      k++;
+    }
+
+    if (mixed_precision) {
+      blas::copy(x, xS);
+      blas::xpy(y, x);
+    }
+
+    profile.TPSTOP(QUDA_PROFILE_COMPUTE);
+    profile.TPSTART(QUDA_PROFILE_EPILOGUE);
+
+    param.secs = profile.Last(QUDA_PROFILE_COMPUTE);
+    double gflops = (blas::flops + mat.flops() + matSloppy.flops()) * 1e-9;
+    param.gflops = gflops;
+    param.iter += k;
+
+    if (k == param.maxiter) warningQuda("Exceeded maximum iterations %d", param.maxiter);
+
+    if (getVerbosity() >= QUDA_VERBOSE) printfQuda("PipelinedCG: Residual replacements = %d\n", rUpdate);
+
+    // compute the true residuals (unless we have just done so)
+    if ((param.compute_true_res || param.preserve_source == QUDA_PRESERVE_SOURCE_NO) && !replaced) {
+      mat(r, x, y, tmp);
+      r2 = blas::xmyNorm(b, r);
+      param.true_res = sqrt(r2 / b2);
+    }
+    param.true_res_hq = 0.0;
+
+    if (param.preserve_source == QUDA_PRESERVE_SOURCE_NO) blas::copy(b, r);
+
+    PrintSummary("PipelinedCG", k, r2, b2, stop, param.tol_hq);
+
+    // reset the flops counters
+    blas::flops = 0;
+    mat.flops();
+    matSloppy.flops();
+
+    profile.TPSTOP(QUDA_PROFILE_EPILOGUE);
+  }
+
+} // namespace quda
@@ -0,0 +1,701 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#include <quda.h>
+#include <quda_internal.h>
+#include <comm_quda.h>
+#include <util_quda.h>
+#include <qio_field.h>
+
+/**
+   @file lime_field.cpp
+
+   Native reader and writer of SciDAC single-file LIME lattice files,
+   which does not depend on QIO.  Rank 0 parses or writes the LIME
+   record headers and XML metadata, and then every rank reads or
+   writes the sites of its own sub-volume of the binary data directly
+   with pread / pwrite, converting precision and byte order and
+   accumulating its part of the SciDAC checksum as it goes.  The
+   checksum partials are combined with a single reduction.
+
+   The files written are laid out as QIO writes them with QIO_SINGLEFILE
+   and QIO_ILDGNO, and the files read may be any SciDAC single-file
+   field record, e.g., as written by QIO.
+*/
+
+namespace
+{
+
+  constexpr uint32_t lime_magic = 0x456789ab;
+  constexpr uint16_t lime_version = 1;
+  constexpr size_t lime_header_bytes = 144;
+  constexpr size_t lime_type_bytes = 128;
+
+  // LIME record payloads are padded to a multiple of eight bytes
+  uint64_t lime_padded(uint64_t bytes) { return (bytes + 7) & ~static_cast<uint64_t>(7); }
+
+  void put_be(unsigned char *dst, uint64_t value, int bytes)
+  {
+    for (int i = bytes - 1; i >= 0; i--, value >>= 8) dst[i] = value & 0xff;
+  }
+
+  uint64_t get_be(const unsigned char *src, int bytes)
+  {
+    uint64_t value = 0;
+    for (int i = 0; i < bytes; i++) value = (value << 8) | src[i];
+    return value;
+  }
+
+  void pwrite_all(int fd, const void *buf, size_t bytes, uint64_t offset, const char *filename)
+  {
+    const char *p = static_cast<const char *>(buf);
+    while (bytes > 0) {
+      ssize_t n = pwrite(fd, p, bytes, offset);
+      if (n < 0)
+        errorQuda("Failed to write %lu bytes at offset %lu of %s (%s)", bytes, offset, filename, strerror(errno));
+      p += n;
+      bytes -= n;
+      offset += n;
+    }
+  }
+
+  void pread_all(int fd, void *buf, size_t bytes, uint64_t offset, const char *filename)
+  {
+    char *p = static_cast<char *>(buf);
+    while (bytes > 0) {
+      ssize_t n = pread(fd, p, bytes, offset);
+      if (n < 0)
+        errorQuda("Failed to read %lu bytes at offset %lu of %s (%s)", bytes, offset, filename, strerror(errno));
+      if (n == 0) errorQuda("Unexpected end of file reading %lu bytes at offset %lu of %s", bytes, offset, filename);
+      p += n;
+      bytes -= n;
+      offset += n;
+    }
+  }
+
+  /**
+     @brief Write a LIME record header at the given offset
+     @return The offset of the record payload
+  */
+  uint64_t write_lime_header(int fd, uint64_t offset, const char *type, uint64_t bytes, bool mb, bool me,
+                             const char *filename)
+  {
+    unsigned char header[lime_header_bytes] = {};
+    put_be(header, lime_magic, 4);
+    put_be(header + 4, lime_version, 2);
+    header[6] = (mb ? 0x80 : 0) | (me ? 0x40 : 0);
+    put_be(header + 8, bytes, 8);
+    strncpy(reinterpret_cast<char *>(header + 16), type, lime_type_bytes - 1);
+    pwrite_all(fd, header, lime_header_bytes, offset, filename);
+    return offset + lime_header_bytes;
+  }
+
+  /**
+     @brief Write a complete LIME record, with its padding
+     @return The offset of the next record
+  */
+  uint64_t write_lime_record(int fd, uint64_t offset, const char *type, const std::string &data, bool mb, bool me,
+                             const char *filename)
+  {
+    offset = write_lime_header(fd, offset, type, data.size(), mb, me, filename);
+    std::string padded(data);
+    padded.resize(lime_padded(data.size()), '\0');
+    pwrite_all(fd, padded.data(), padded.size(), offset, filename);
+    return offset + padded.size();
+  }
+
+  /**
+     @brief Return the contents of the first <tag> element of the
+     given XML string, or an empty string if there is none
+  */
+  std::string xml_value(const std::string &xml, const char *tag)
+  {
+    const std::string open = std::string("<") + tag + ">";
+    const std::string close = std::string("</") + tag + ">";
+    size_t begin = xml.find(open);
+    if (begin == std::string::npos) return "";
+    begin += open.size();
+    size_t end = xml.find(close, begin);
+    return end == std::string::npos ? "" : xml.substr(begin, end - begin);
+  }
+
+  /**
+     @brief CRC-32 (as used by zlib) of the given bytes
+  */
+  uint32_t crc32(const unsigned char *data, size_t bytes)
+  {
+    static const std::vector<uint32_t> table = [] {
+      std::vector<uint32_t> table(256);
+      for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; k++) c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+        table[i] = c;
+      }
+      return table;
+    }();
+
+    uint32_t crc = 0xffffffffu;
+    for (size_t i = 0; i < bytes; i++) crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+    return crc ^ 0xffffffffu;
+  }
+
+  uint32_t rotl(uint32_t x, int n) { return n ? (x << n) | (x >> (32 - n)) : x; }
+
+  /**
+     @brief The SciDAC checksum, which is the XOR over all sites of the
+     CRC-32 of each site's data (in host byte order), rotated left by
+     the global lexicographic site index modulo 29 and 31 respectively
+  */
+  struct Checksum {
+    uint32_t suma = 0;
+    uint32_t sumb = 0;
+
+    void accumulate(uint64_t site, const void *data, size_t bytes)
+    {
+      uint32_t crc = crc32(static_cast<const unsigned char *>(data), bytes);
+      suma ^= rotl(crc, site % 29);
+      sumb ^= rotl(crc, site % 31);
+    }
+
+    Checksum &operator^=(const Checksum &other)
+    {
+      suma ^= other.suma;
+      sumb ^= other.sumb;
+      return *this;
+    }
+
+    /**
+       @brief Combine the partial checksums of all ranks
+    */
+    void allreduce()
+    {
+      uint64_t sum = (static_cast<uint64_t>(suma) << 32) | sumb;
+      comm_allreduce_xor(&sum);
+      suma = sum >> 32;
+      sumb = sum & 0xffffffffu;
+    }
+  };
+
+  bool host_big_endian()
+  {
+    const uint32_t one = 1;
+    unsigned char byte;
+    memcpy(&byte, &one, 1);
+    return byte == 0;
+  }
+
+  /**
+     @brief Reverse the byte order of n words of the given size, in a
+     form that the compiler can vectorize
+  */
+  void byte_reverse(void *data, size_t n, int word_size)
+  {
+    if (word_size == 8) {
+      uint64_t *w = static_cast<uint64_t *>(data);
+#pragma omp simd
+      for (size_t i = 0; i < n; i++) w[i] = __builtin_bswap64(w[i]);
+    } else if (word_size == 4) {
+      uint32_t *w = static_cast<uint32_t *>(data);
+#pragma omp simd
+      for (size_t i = 0; i < n; i++) w[i] = __builtin_bswap32(w[i]);
+    } else {
+      errorQuda("Unsupported word size %d", word_size);
+    }
+  }
+
+  /**
+     Mapping between the file, in which sites are ordered
+     lexicographically over the global lattice with x running fastest,
+     and the local field, which is even-odd ordered (lexicographically
+     ordered for single-parity fields) as QUDA's CPU fields are.  The sites of this
+     rank form contiguous runs in the file, each spanning the leading
+     dimensions up to and including the first partitioned one.  Runs are
+     split into chunks of at most max_chunk sites, which are the units of
+     work and I/O, so that the work scales with the volume even when few
+     dimensions are partitioned, and the per-thread buffers stay small.
+  */
+  struct Layout {
+    static constexpr int nDim = 4;
+    static constexpr size_t max_chunk = 1024;
+    int X[nDim];      // local dimensions
+    int L[nDim];      // global dimensions
+    int offset[nDim]; // global coordinates of the local origin
+    bool single_parity;
+    size_t volume; // local volume
+    uint64_t global_volume;
+    int run_dims;          // number of leading dimensions spanned by each run
+    size_t run;            // sites per run
+    size_t n_run;          // runs per rank
+    size_t chunk;          // maximum sites per chunk
+    size_t chunks_per_run; // chunks per run
+    size_t n_chunk;        // chunks per rank
+
+    Layout(const int *X_, QudaSiteSubset subset) :
+      single_parity(subset == QUDA_PARITY_SITE_SUBSET), volume(1), global_volume(1)
+    {
+      for (int d = 0; d < nDim; d++) {
+        X[d] = X_[d];
+        L[d] = comm_dim(d) * X[d];
+        offset[d] = comm_coord(d) * X[d];
+        volume *= X[d];
+        global_volume *= L[d];
+      }
+
+      run_dims = 1;
+      while (run_dims < nDim && comm_dim(run_dims - 1) == 1) run_dims++;
+      run = 1;
+      for (int d = 0; d < run_dims; d++) run *= X[d];
+      n_run = volume / run;
+      chunk = run < max_chunk ? run : max_chunk;
+      chunks_per_run = (run + chunk - 1) / chunk;
+      n_chunk = n_run * chunks_per_run;
+    }
+
+    /**
+       @brief The global lexicographic index of the first site of the
+       given chunk, and the local coordinates of that site
+       @return The number of sites in the chunk
+    */
+    size_t chunk_begin(size_t c, uint64_t &site, int x[nDim]) const
+    {
+      size_t r = c / chunks_per_run;
+      const size_t begin = (c % chunks_per_run) * chunk;
+
+      size_t s = begin;
+      for (int d = 0; d < run_dims; d++) {
+        x[d] = s % X[d];
+        s /= X[d];
+      }
+      for (int d = run_dims; d < nDim; d++) {
+        x[d] = r % X[d];
+        r /= X[d];
+      }
+
+      // the sites of a run are contiguous in the file
+      site = 0;
+      for (int d = nDim - 1; d >= run_dims; d--) site = site * L[d] + offset[d] + x[d];
+      for (int d = run_dims - 1; d >= 0; d--) site = site * L[d] + offset[d];
+      site += begin;
+
+      return run - begin < chunk ? run - begin : chunk;
+    }
+
+    /**
+       @brief The local field index of the site with local coordinates x
+    */
+    size_t local_index(const int x[nDim]) const
+    {
+      size_t r = 0;
+      int p = 0;
+      for (int d = nDim - 1; d >= 0; d--) {
+        r = r * X[d] + x[d];
+        p += offset[d] + x[d];
+      }
+      if (single_parity) return r;
+      return (p % 2 == 0) ? r / 2 : (r + volume) / 2;
+    }
+
+    /**
+       @brief Advance the local coordinates x to the next site of a run
+    */
+    void next(int x[nDim]) const
+    {
+      for (int d = 0; d < run_dims; d++) {
+        if (++x[d] < X[d]) return;
+        x[d] = 0;
+      }
+    }
+  };
+
+  /**
+     Metadata of a field record, gathered by rank 0 and broadcast
+  */
+  struct RecordInfo {
+    uint64_t data_offset;
+    uint64_t data_bytes;
+    int file_prec; // bytes per real number
+    int typesize;
+    int datacount;
+    int nSpin;
+    int nColor;
+    int dims[Layout::nDim];
+    int has_checksum;
+    uint32_t suma;
+    uint32_t sumb;
+  };
+
+  /**
+     @brief Walk the LIME records of the file on rank 0, extracting the
+     metadata of the first field record
+  */
+  RecordInfo scan_lime_file(const char *filename)
+  {
+    RecordInfo info = {};
+    info.data_offset = 0;
+
+    if (comm_rank() == 0) {
+      int fd = open(filename, O_RDONLY);
+      if (fd < 0) errorQuda("Failed to open %s for reading (%s)", filename, strerror(errno));
+      off_t file_bytes = lseek(fd, 0, SEEK_END);
+      if (file_bytes < 0) errorQuda("Failed to determine the size of %s", filename);
+
+      bool have_data = false;
+      bool have_record_xml = false;
+      uint64_t offset = 0;
+      while (offset + lime_header_bytes <= static_cast<uint64_t>(file_bytes)) {
+        unsigned char header[lime_header_bytes];
+        pread_all(fd, header, lime_header_bytes, offset, filename);
+        if (get_be(header, 4) != lime_magic)
+          errorQuda("Invalid LIME record header at offset %lu of %s", offset, filename);
+
+        const uint64_t bytes = get_be(header + 8, 8);
+        char type_buf[lime_type_bytes + 1] = {};
+        memcpy(type_buf, header + 16, lime_type_bytes);
+        const std::string type(type_buf);
+        const uint64_t payload = offset + lime_header_bytes;
+
+        if (type == "scidac-binary-data" || type == "ildg-binary-data") {
+          if (!have_data) {
+            info.data_offset = payload;
+            info.data_bytes = bytes;
+            have_data = true;
+          }
+        } else if (!have_data || type == "scidac-checksum") {
+          // the metadata records are small, and only those preceding the data or its checksum are of interest
+          std::string xml(bytes, '\0');
+          pread_all(fd, &xml[0], bytes, payload, filename);
+
+          if (type == "scidac-private-file-xml") {
+            std::string dims = xml_value(xml, "dims");
+            if (sscanf(dims.c_str(), "%d %d %d %d", &info.dims[0], &info.dims[1], &info.dims[2], &info.dims[3]) != 4)
+              errorQuda("Unable to parse the lattice dimensions \"%s\" of %s", dims.c_str(), filename);
+          } else if (type == "scidac-private-record-xml") {
+            info.file_prec = xml_value(xml, "precision") == "F" ? 4 : 8;
+            info.nColor = atoi(xml_value(xml, "colors").c_str());
+            info.nSpin = atoi(xml_value(xml, "spins").c_str());
+            info.typesize = atoi(xml_value(xml, "typesize").c_str());
+            info.datacount = atoi(xml_value(xml, "datacount").c_str());
+            have_record_xml = true;
+          } else if (type == "ildg-format" && !have_record_xml) {
+            // ILDG gauge fields which lack the SciDAC record metadata
+            info.file_prec = atoi(xml_value(xml, "precision").c_str()) / 8;
+            info.nColor = 3;
+            info.nSpin = 0;
+            info.typesize = 18 * info.file_prec;
+            info.datacount = 4;
+            const char *tags[] = {"lx", "ly", "lz", "lt"};
+            for (int d = 0; d < Layout::nDim; d++) info.dims[d] = atoi(xml_value(xml, tags[d]).c_str());
+          } else if (type == "scidac-checksum" && have_data) {
+            info.suma = strtoul(xml_value(xml, "suma").c_str(), nullptr, 16);
+            info.sumb = strtoul(xml_value(xml, "sumb").c_str(), nullptr, 16);
+            info.has_checksum = 1;
+            break;
+          }
+        }
+
+        offset = payload + lime_padded(bytes);
+      }
+      close(fd);
+
+      if (!have_data) errorQuda("No binary data record found in %s", filename);
+      if (info.file_prec != 4 && info.file_prec != 8) errorQuda("No valid record metadata found in %s", filename);
+    }
+
+    comm_broadcast(&info, sizeof(info));
+    return info;
+  }
+
+  /**
+     @brief Read this rank's sites of the binary data, converting from
+     the file precision fFloat to the field precision cFloat
+  */
+  template <typename cFloat, typename fFloat>
+  Checksum read_sites(int fd, const char *filename, const Layout &layout, uint64_t data_offset, void *field[],
+                      int count, int len)
+  {
+    const size_t site_reals = static_cast<size_t>(count) * len;
+    const size_t site_bytes = site_reals * sizeof(fFloat);
+    const bool reverse = !host_big_endian();
+    Checksum checksum;
+
+#pragma omp parallel
+    {
+      std::vector<fFloat> buffer; // allocated only by threads with work
+      Checksum thread_checksum;
+
+#pragma omp for schedule(static)
+      for (size_t c = 0; c < layout.n_chunk; c++) {
+        if (buffer.empty()) buffer.resize(layout.chunk * site_reals);
+        int x[Layout::nDim];
+        uint64_t site;
+        const size_t sites = layout.chunk_begin(c, site, x);
+        pread_all(fd, buffer.data(), sites * site_bytes, data_offset + site * site_bytes, filename);
+        if (reverse) byte_reverse(buffer.data(), sites * site_reals, sizeof(fFloat));
+
+        for (size_t s = 0; s < sites; s++, layout.next(x)) {
+          const fFloat *src = buffer.data() + s * site_reals;
+          thread_checksum.accumulate(site + s, src, site_bytes);
+
+          const size_t index = layout.local_index(x);
+          for (int i = 0; i < count; i++) {
+            cFloat *dst = static_cast<cFloat *>(field[i]) + len * index;
+#pragma omp simd
+            for (int j = 0; j < len; j++) dst[j] = src[i * len + j];
+          }
+        }
+      }
+
+#pragma omp critical
+      checksum ^= thread_checksum;
+    }
+
+    return checksum;
+  }
+
+  /**
+     @brief Write this rank's sites of the binary data, converting from
+     the field precision cFloat to the file precision fFloat
+  */
+  template <typename cFloat, typename fFloat>
+  Checksum write_sites(int fd, const char *filename, const Layout &layout, uint64_t data_offset, void *field[],
+                       int count, int len)
+  {
+    const size_t site_reals = static_cast<size_t>(count) * len;
+    const size_t site_bytes = site_reals * sizeof(fFloat);
+    const bool reverse = !host_big_endian();
+    Checksum checksum;
+
+#pragma omp parallel
+    {
+      std::vector<fFloat> buffer; // allocated only by threads with work
+      Checksum thread_checksum;
+
+#pragma omp for schedule(static)
+      for (size_t c = 0; c < layout.n_chunk; c++) {
+        if (buffer.empty()) buffer.resize(layout.chunk * site_reals);
+        int x[Layout::nDim];
+        uint64_t site;
+        const size_t sites = layout.chunk_begin(c, site, x);
+
+        for (size_t s = 0; s < sites; s++, layout.next(x)) {
+          fFloat *dst = buffer.data() + s * site_reals;
+          const size_t index = layout.local_index(x);
+          for (int i = 0; i < count; i++) {
+            const cFloat *src = static_cast<const cFloat *>(field[i]) + len * index;
+#pragma omp simd
+            for (int j = 0; j < len; j++) dst[i * len + j] = src[j];
+          }
+          thread_checksum.accumulate(site + s, dst, site_bytes);
+        }
+
+        if (reverse) byte_reverse(buffer.data(), sites * site_reals, sizeof(fFloat));
+        pwrite_all(fd, buffer.data(), sites * site_bytes, data_offset + site * site_bytes, filename);
+      }
+
+#pragma omp critical
+      checksum ^= thread_checksum;
+    }
+
+    return checksum;
+  }
+
+  void read_field_lime(const char *filename, void *field[], QudaPrecision cpu_prec, const int *X,
+                       QudaSiteSubset subset, int count, int len, int nSpin, int nColor)
+  {
+    if (cpu_prec != QUDA_DOUBLE_PRECISION && cpu_prec != QUDA_SINGLE_PRECISION)
+      errorQuda("Unsupported field precision %d", cpu_prec);
+
+    const Layout layout(X, subset);
+    const RecordInfo info = scan_lime_file(filename);
+
+    // as for QIO, we exclude gauge fields from the spin and color checks, since
+    // QUDA originally saved gauge fields with nSpin = 1 and nColor = 9
+    if (len != 18) {
+      if (info.nSpin != nSpin) warningQuda("File nSpin %d does not match expected nSpin %d", info.nSpin, nSpin);
+      if (info.nColor != nColor) warningQuda("File nColor %d does not match expected nColor %d", info.nColor, nColor);
+    }
+    if (info.datacount != count)
+      errorQuda("File datacount %d does not match expected number of fields %d", info.datacount, count);
+    if (info.typesize != info.file_prec * len)
+      errorQuda("File typesize %d does not match expected datasize %d", info.typesize, info.file_prec * len);
+    for (int d = 0; d < Layout::nDim; d++)
+      if (info.dims[d] != layout.L[d])
+        errorQuda("File lattice dimensions (%d, %d, %d, %d) do not match expected (%d, %d, %d, %d)", info.dims[0],
+                  info.dims[1], info.dims[2], info.dims[3], layout.L[0], layout.L[1], layout.L[2], layout.L[3]);
+    if (info.data_bytes != layout.global_volume * count * info.typesize)
+      errorQuda("File binary data length %lu does not match expected %lu", info.data_bytes,
+                layout.global_volume * count * info.typesize);
+
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) errorQuda("Failed to open %s for reading (%s)", filename, strerror(errno));
+
+    Checksum checksum;
+    if (cpu_prec == QUDA_DOUBLE_PRECISION) {
+      if (info.file_prec == 8)
+        checksum = read_sites<double, double>(fd, filename, layout, info.data_offset, field, count, len);
+      else
+        checksum = read_sites<double, float>(fd, filename, layout, info.data_offset, field, count, len);
+    } else {
+      if (info.file_prec == 8)
+        checksum = read_sites<float, double>(fd, filename, layout, info.data_offset, field, count, len);
+      else
+        checksum = read_sites<float, float>(fd, filename, layout, info.data_offset, field, count, len);
+    }
+    close(fd);
+
+    checksum.allreduce();
+    if (info.has_checksum) {
+      if (checksum.suma != info.suma || checksum.sumb != info.sumb)
+        errorQuda("Checksum mismatch reading %s: computed %x %x, file %x %x", filename, checksum.suma, checksum.sumb,
+                  info.suma, info.sumb);
+      if (getVerbosity() >= QUDA_VERBOSE) printfQuda("%s: checksums %x %x verified\n", __func__, info.suma, info.sumb);
+    } else {
+      warningQuda("No checksum found in %s", filename);
+    }
+  }
+
+  void write_field_lime(const char *filename, void *field[], QudaPrecision cpu_prec, const int *X,
+                        QudaSiteSubset subset, QudaParity parity, int count, int len, int nSpin, int nColor,
+                        const char *type)
+  {
+    if (cpu_prec != QUDA_DOUBLE_PRECISION && cpu_prec != QUDA_SINGLE_PRECISION)
+      errorQuda("Unsupported field precision %d", cpu_prec);
+    const QudaPrecision file_prec = cpu_prec;
+
+    const Layout layout(X, subset);
+    const uint64_t data_bytes = layout.global_volume * count * file_prec * len;
+
+    // rank 0 creates the file and writes the metadata preceding the binary data
+    uint64_t data_offset = 0;
+    int fd = -1;
+    if (comm_rank() == 0) {
+      fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      if (fd < 0) errorQuda("Failed to open %s for writing (%s)", filename, strerror(errno));
+
+      const std::string xml_header = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>";
+
+      std::string file_info = xml_header + "<scidacFile><version>1.1</version><spacetime>4</spacetime><dims>";
+      for (int d = 0; d < Layout::nDim; d++) file_info += std::to_string(layout.L[d]) + " ";
+      file_info += "</dims><volfmt>0</volfmt></scidacFile>";
+
+      time_t now = time(nullptr);
+      struct tm utc;
+      gmtime_r(&now, &utc);
+      char date[64];
+      strftime(date, sizeof(date), "%a %b %e %H:%M:%S %Y UTC", &utc);
+
+      std::string record_info = xml_header + "<scidacRecord><version>1.1</version><date>" + date
+        + "</date><recordtype>0</recordtype><datatype>" + type + "</datatype><precision>"
+        + (file_prec == QUDA_DOUBLE_PRECISION ? "D" : "F") + "</precision><colors>" + std::to_string(nColor)
+        + "</colors><spins>" + std::to_string(nSpin) + "</spins><typesize>" + std::to_string(file_prec * len)
+        + "</typesize><datacount>" + std::to_string(count) + "</datacount></scidacRecord>";
+
+      // the same user record XML as written by the QIO writer
+      std::string field_name;
+      switch (len) {
+      case 6: field_name = "StaggeredColorSpinorField"; break;
+      case 18: field_name = "GaugeFieldFile"; break;
+      case 24: field_name = "WilsonColorSpinorField"; break;
+      default: field_name = "MGColorSpinorField"; break;
+      }
+      std::string record_xml = xml_header + "<quda" + field_name + "><version>BETA</version><type>" + type
+        + "</type><info><subset>" + (subset == QUDA_PARITY_SITE_SUBSET ? "parity" : "full") + "</subset><parity>"
+        + (parity == QUDA_EVEN_PARITY ? "even" : parity == QUDA_ODD_PARITY ? "odd" : "full")
+        + "</parity><nColor>" + std::to_string(nColor) + "</nColor><nSpin>" + std::to_string(nSpin)
+        + "</nSpin></info></quda" + field_name + ">";
+
+      uint64_t offset = 0;
+      offset = write_lime_record(fd, offset, "scidac-private-file-xml", file_info, true, false, filename);
+      offset = write_lime_record(fd, offset, "scidac-file-xml", "Dummy user file XML", false, true, filename);
+      offset = write_lime_record(fd, offset, "scidac-private-record-xml", record_info, true, false, filename);
+      offset = write_lime_record(fd, offset, "scidac-record-xml", record_xml, false, false, filename);
+      data_offset = write_lime_header(fd, offset, "scidac-binary-data", data_bytes, false, false, filename);
+    }
+
+    // the broadcast also ensures the file exists before the other ranks open it
+    comm_broadcast(&data_offset, sizeof(data_offset));
+    if (comm_rank() != 0) {
+      fd = open(filename, O_WRONLY);
+      if (fd < 0) errorQuda("Failed to open %s for writing (%s)", filename, strerror(errno));
+    }
+
+    Checksum checksum;
+    if (cpu_prec == QUDA_DOUBLE_PRECISION)
+      checksum = write_sites<double, double>(fd, filename, layout, data_offset, field, count, len);
+    else
+      checksum = write_sites<float, float>(fd, filename, layout, data_offset, field, count, len);
+    checksum.allreduce();
+
+    // rank 0 pads the binary data and closes the message with the checksum
+    if (comm_rank() == 0) {
+      uint64_t offset = data_offset + data_bytes;
+      const std::string padding(lime_padded(data_bytes) - data_bytes, '\0');
+      if (padding.size() > 0) pwrite_all(fd, padding.data(), padding.size(), offset, filename);
+      offset += padding.size();
+
+      char sums[128];
+      snprintf(sums, sizeof(sums), "<suma>%x</suma><sumb>%x</sumb>", checksum.suma, checksum.sumb);
+      std::string checksum_xml = std::string("<?xml version=\"1.0\" encoding=\"UTF-8\"?><scidacChecksum>")
+        + "<version>1.0</version>" + sums + "</scidacChecksum>";
+      write_lime_record(fd, offset, "scidac-checksum", checksum_xml, false, true, filename);
+    }
+
+    if (close(fd) != 0) errorQuda("Failed to close %s (%s)", filename, strerror(errno));
+    comm_barrier();
+    if (getVerbosity() >= QUDA_VERBOSE) printfQuda("%s: checksums %x %x\n", __func__, checksum.suma, checksum.sumb);
+  }
+
+} // namespace
+
+void read_gauge_field_lime(const char *filename, void *gauge[], QudaPrecision precision, const int *X)
+{
+  printfQuda("%s: reading su3 field from %s\n", __func__, filename);
+  read_field_lime(filename, gauge, precision, X, QUDA_FULL_SITE_SUBSET, 4, 18, 1, 9);
+}
+
+void write_gauge_field_lime(const char *filename, void *gauge[], QudaPrecision precision, const int *X)
+{
+  char type[128];
+  sprintf(type, "QUDA_%sNc%d_GaugeField", (precision == QUDA_DOUBLE_PRECISION) ? "D" : "F", 3);
+
+  printfQuda("%s: writing the gauge field to %s\n", __func__, filename);
+  write_field_lime(filename, gauge, precision, X, QUDA_FULL_SITE_SUBSET, QUDA_INVALID_PARITY, 4, 18, 0, 3, type);
+}
+
+void read_spinor_field_lime(const char *filename, void *V[], QudaPrecision precision, const int *X,
+                            QudaSiteSubset subset, QudaParity parity, int nColor, int nSpin, int Nvec)
+{
+  printfQuda("%s: reading %d vector fields from %s\n", __func__, Nvec, filename);
+  read_field_lime(filename, V, precision, X, subset, Nvec, 2 * nSpin * nColor, nSpin, nColor);
+}
+
+void write_spinor_field_lime(const char *filename, void *V[], QudaPrecision precision, const int *X,
+                             QudaSiteSubset subset, QudaParity parity, int nColor, int nSpin, int Nvec)
+{
+  char type[128];
+  sprintf(type, "QUDA_%sNs%dNc%d_ColorSpinorField", (precision == QUDA_DOUBLE_PRECISION) ? "D" : "F", nSpin, nColor);
+
+  printfQuda("%s: writing %d vector fields to %s\n", __func__, Nvec, filename);
+  write_field_lime(filename, V, precision, X, subset, parity, Nvec, 2 * nSpin * nColor, nSpin, nColor, type);
+}
+
+bool native_io_enabled()
+{
+#ifdef HAVE_QIO
+  static const bool enable = [] {
+    char *enable_env = getenv("QUDA_ENABLE_NATIVE_IO");
+    return enable_env && strcmp(enable_env, "0") != 0;
+  }();
+  return enable;
+#else
+  return true;
+#endif
+}
@@ -28,6 +28,7 @@ namespace quda {
       const T &a, &b, &c;
       std::vector<ColorSpinorField *> &x, &y, &z, &w;
       const QudaFieldLocation location;
+      std::vector<signed char> a_h, b_h, c_h; // host coefficients converted to the host functor precision
 
       bool tuneSharedBytes() const { return false; }
 
@@ -81,6 +82,7 @@ namespace quda {
           strcat(aux, ",");
           strcat(aux, y[0]->AuxString());
         }
+        if (location == QUDA_CPU_FIELD_LOCATION) strcat(aux, ",CPU");
 
 #ifdef JITIFY
         ::quda::create_jitify_program("kernels/multi_blas_core.cuh");
@@ -93,6 +95,14 @@ namespace quda {
         blas::flops += flops();
       }
 
+      ~MultiBlas()
+      {
+        // the host coefficient pointers may refer to a_h etc., so do not let them outlive this object
+        Amatrix_h = nullptr;
+        Bmatrix_h = nullptr;
+        Cmatrix_h = nullptr;
+      }
+
       TuneKey tuneKey() const
       {
         char name[TuneKey::name_n];
@@ -138,6 +148,30 @@ namespace quda {
 #endif
       }
 
+      template <bool multi_1d, typename coeff_t, typename Arg> typename std::enable_if<multi_1d, void>::type
+      set_host_param(std::vector<signed char> &, signed char *&, Arg &arg, char select, const T &h, const qudaStream_t &stream)
+      {
+        set_param<multi_1d>(nullptr, arg, select, h, stream);
+      }
+
+      /**
+         @brief Convert the coefficients to the precision of the host
+         functor, and point the host coefficient pointer at them
+         @param[out] buf Host buffer holding the converted coefficients,
+         owned by this object so that matrix_h outlives the launch
+         @param[out] matrix_h Host coefficient pointer read by the functor
+         @param[in] h Coefficient array
+      */
+      template <bool multi_1d, typename coeff_t, typename Arg> typename std::enable_if<!multi_1d, void>::type
+      set_host_param(std::vector<signed char> &buf, signed char *&matrix_h, Arg &, char, const T &h, const qudaStream_t &)
+      {
+        buf.resize(NXZ * NYW * sizeof(coeff_t));
+        coeff_t *coeff = reinterpret_cast<coeff_t *>(buf.data());
+        for (int i = 0; i < NXZ; i++)
+          for (int j = 0; j < NYW; j++) coeff[NYW * i + j] = coeff_t(h.data[NYW * i + j]);
+        matrix_h = buf.data();
+      }
+
       template <int NXZ> void compute(const qudaStream_t &stream)
       {
         staticCheck<NXZ, store_t, y_store_t, decltype(f)>(f, x, y);
@@ -191,7 +225,29 @@ namespace quda {
 
           tp.block.x /= tp.aux.x; // restore block size
         } else {
-          errorQuda("Only implemented for GPU fields");
+          if (checkOrder(*x[0], *y[0], *z[0], *w[0]) != QUDA_SPACE_SPIN_COLOR_FIELD_ORDER)
+            errorQuda("CPU multi-blas functions expect AoS field order");
+
+          using host_store_t = typename host_type_mapper<store_t>::type;
+          using host_y_store_t = typename host_type_mapper<y_store_t>::type;
+          using host_real_t = typename mapper<host_y_store_t>::type;
+          Functor<host_real_t> f_(NXZ, NYW);
+
+          // redefine site_unroll with host_store types to ensure we have correct N/Ny/M values
+          constexpr bool site_unroll = !std::is_same<host_store_t, host_y_store_t>::value || isFixed<host_store_t>::value;
+          constexpr int N = n_vector<host_store_t, false, nSpin, site_unroll>();
+          constexpr int Ny = n_vector<host_y_store_t, false, nSpin, site_unroll>();
+          constexpr int M = N; // if site unrolling then M=N will be 24/6, e.g., full AoS
+          const int length = x[0]->Length() / (nParity * M);
+
+          MultiBlasArg<NXZ, host_store_t, N, host_y_store_t, Ny, decltype(f_)> arg(x, y, z, w, f_, NYW, length);
+
+          using coeff_t = typename decltype(f_)::coeff_t;
+          if (a.data) set_host_param<decltype(f_)::multi_1d, coeff_t>(a_h, Amatrix_h, arg, 'a', a, stream);
+          if (b.data) set_host_param<decltype(f_)::multi_1d, coeff_t>(b_h, Bmatrix_h, arg, 'b', b, stream);
+          if (c.data) set_host_param<decltype(f_)::multi_1d, coeff_t>(c_h, Cmatrix_h, arg, 'c', c, stream);
+
+          multiBlasCPU<host_real_t, M, NXZ>(arg, nParity);
         }
       }
 
@@ -280,6 +336,11 @@ namespace quda {
       int blockStep() const { return deviceProp.warpSize / warp_split; }
       int blockMin() const { return deviceProp.warpSize / warp_split; }
 
+      bool advanceTuneParam(TuneParam &param) const
+      {
+        return location == QUDA_CPU_FIELD_LOCATION ? false : TunableVectorY::advanceTuneParam(param);
+      }
+
       void initTuneParam(TuneParam &param) const
       {
         TunableVectorY::initTuneParam(param);
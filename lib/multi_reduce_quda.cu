@@ -82,6 +82,7 @@ namespace quda {
       std::vector<ColorSpinorField *> &x, &y, &z, &w;
       host_reduce_t *result;
       QudaFieldLocation location;
+      std::vector<signed char> a_h, b_h, c_h; // host coefficients converted to the host reducer precision
 
       unsigned int sharedBytesPerThread() const { return 0; }
       unsigned int sharedBytesPerBlock(const TuneParam &param) const { return 0; }
@@ -135,6 +136,7 @@ namespace quda {
           strcat(aux, y[0]->AuxString());
         }
         if (getFastReduce()) strcat(aux, ",fast_reduce");
+        if (location == QUDA_CPU_FIELD_LOCATION) strcat(aux, ",CPU");
 
         // since block dot product and block norm use the same functors, we need to distinguish them
         bool is_norm = false;
@@ -160,6 +162,14 @@ namespace quda {
         blas::flops += flops();
       }
 
+      ~MultiReduce()
+      {
+        // the host coefficient pointers may refer to a_h etc., so do not let them outlive this object
+        Amatrix_h = nullptr;
+        Bmatrix_h = nullptr;
+        Cmatrix_h = nullptr;
+      }
+
       TuneKey tuneKey() const
       {
         char name[TuneKey::name_n];
@@ -186,6 +196,23 @@ namespace quda {
         //cuMemcpyHtoDAsync(d, tmp, NXZ * NYW * sizeof(decltype(tmp[0])), stream);
       }
 
+      /**
+         @brief Convert the coefficients to the precision of the host
+         reducer, and point the host coefficient pointer at them
+         @param[out] buf Host buffer holding the converted coefficients,
+         owned by this object so that matrix_h outlives the launch
+         @param[out] matrix_h Host coefficient pointer read by the reducer
+         @param[in] h Coefficient array
+      */
+      template <typename coeff_t> void set_host_param(std::vector<signed char> &buf, signed char *&matrix_h, const T &h)
+      {
+        buf.resize(NXZ * NYW * sizeof(coeff_t));
+        coeff_t *coeff = reinterpret_cast<coeff_t *>(buf.data());
+        for (int i = 0; i < NXZ; i++)
+          for (int j = 0; j < NYW; j++) coeff[NYW * i + j] = coeff_t(h.data[NYW * i + j]);
+        matrix_h = buf.data();
+      }
+
       template <int NXZ> void compute(const qudaStream_t &stream)
       {
         staticCheck<NXZ, store_t, y_store_t, decltype(r)>(r, x, y);
@@ -222,7 +249,30 @@ namespace quda {
 #endif
           multiReduceLaunch<device_real_t, M, NXZ>(result, arg, tp, stream, *this);
         } else {
-          errorQuda("Only implemented for GPU fields");
+          if (checkOrder(*x[0], *y[0], *z[0], *w[0]) != QUDA_SPACE_SPIN_COLOR_FIELD_ORDER)
+            errorQuda("CPU multi-reduce functions expect AoS field order");
+
+          using host_store_t = typename host_type_mapper<store_t>::type;
+          using host_y_store_t = typename host_type_mapper<y_store_t>::type;
+          using host_real_t = typename mapper<host_y_store_t>::type;
+          Reducer<double, host_real_t> r_(NXZ, NYW);
+
+          // redefine site_unroll with host_store types to ensure we have correct N/Ny/M values
+          constexpr bool site_unroll = !std::is_same<host_store_t, host_y_store_t>::value || isFixed<host_store_t>::value;
+          constexpr int N = n_vector<host_store_t, false, nSpin, site_unroll>();
+          constexpr int Ny = n_vector<host_y_store_t, false, nSpin, site_unroll>();
+          constexpr int M = N; // if site unrolling then M=N will be 24/6, e.g., full AoS
+          const int length = x[0]->Length() / (nParity * M);
+
+          MultiReduceArg<NXZ, host_store_t, N, host_y_store_t, Ny, decltype(r_)> arg(x, y, z, w, r_, NYW, length);
+
+          // the host reducer reads any coefficients through Amatrix_h etc., so convert to the host coefficient type
+          using coeff_t = typename decltype(r_)::coeff_t;
+          if (a.data) set_host_param<coeff_t>(a_h, Amatrix_h, a);
+          if (b.data) set_host_param<coeff_t>(b_h, Bmatrix_h, b);
+          if (c.data) set_host_param<coeff_t>(c_h, Cmatrix_h, c);
+
+          multiReduceCPU<host_real_t, M, NXZ>(result, arg, nParity);
         }
       }
 
@@ -286,6 +336,11 @@ namespace quda {
         return rtn;
       }
 
+      bool advanceTuneParam(TuneParam &param) const
+      {
+        return location == QUDA_CPU_FIELD_LOCATION ? false : Tunable::advanceTuneParam(param);
+      }
+
       void initTuneParam(TuneParam &param) const
       {
         Tunable::initTuneParam(param);
@@ -462,6 +517,7 @@ namespace quda {
       	strcat(aux, y[0]->AuxString());
         if (hermitian) strcat(aux, ",hermitian");
         if (Anorm) strcat(aux, ",Anorm");
+        if (x[0]->Location() == QUDA_CPU_FIELD_LOCATION) strcat(aux, ",CPU");
 	strcat(aux,",n=");
 	char size[8];
 	u64toa(size, x.size());
@@ -624,6 +680,7 @@ namespace quda {
         strcat(aux, y[0]->AuxString());
         if (hermitian) strcat(aux, ",hermitian");
         if (Anorm) strcat(aux, ",Anorm");
+        if (x[0]->Location() == QUDA_CPU_FIELD_LOCATION) strcat(aux, ",CPU");
         strcat(aux, ",n=");
         char size[8];
         u64toa(size, x.size());
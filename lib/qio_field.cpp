@@ -4,6 +4,7 @@
 #include <quda.h>
 #include <util_quda.h>
 #include <layout_hyper.h>
+#include <qio_field.h>
 
 #include <string>
 
@@ -233,6 +234,11 @@ void set_layout(const int *X, QudaSiteSubset subset = QUDA_FULL_SITE_SUBSET)
 
 void read_gauge_field(const char *filename, void *gauge[], QudaPrecision precision, const int *X, int argc, char *argv[])
 {
+  if (native_io_enabled()) {
+    read_gauge_field_lime(filename, gauge, precision, X);
+    return;
+  }
+
   quda_this_node = QMP_get_node_number();
 
   set_layout(X);
@@ -273,6 +279,11 @@ int read_field(QIO_Reader *infile, int Ninternal, int count, void *field_in[], Q
 void read_spinor_field(const char *filename, void *V[], QudaPrecision precision, const int *X, QudaSiteSubset subset,
                        QudaParity parity, int nColor, int nSpin, int Nvec, int argc, char *argv[])
 {
+  if (native_io_enabled()) {
+    read_spinor_field_lime(filename, V, precision, X, subset, parity, nColor, nSpin, Nvec);
+    return;
+  }
+
   quda_this_node = QMP_get_node_number();
 
   set_layout(X, subset);
@@ -401,6 +412,11 @@ int write_su3_field(QIO_Writer *outfile, int count, void *field_out[],
 
 void write_gauge_field(const char *filename, void *gauge[], QudaPrecision precision, const int *X, int argc, char *argv[])
 {
+  if (native_io_enabled()) {
+    write_gauge_field_lime(filename, gauge, precision, X);
+    return;
+  }
+
   quda_this_node = QMP_get_node_number();
 
   set_layout(X);
@@ -458,6 +474,11 @@ int write_field(QIO_Writer *outfile, int Ninternal, int count, void *field_out[]
 void write_spinor_field(const char *filename, void *V[], QudaPrecision precision, const int *X, QudaSiteSubset subset,
                         QudaParity parity, int nColor, int nSpin, int Nvec, int argc, char *argv[])
 {
+  if (native_io_enabled()) {
+    write_spinor_field_lime(filename, V, precision, X, subset, parity, nColor, nSpin, Nvec);
+    return;
+  }
+
   quda_this_node = QMP_get_node_number();
 
   set_layout(X, subset);
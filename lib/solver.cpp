@@ -3,6 +3,7 @@
 #include <multigrid.h>
 #include <eigensolve_quda.h>
 #include <cmath>
+#include <cstdio>
 
 namespace quda {
 
@@ -21,7 +22,8 @@ namespace quda {
     eig_solve(nullptr),
     deflate_init(false),
     deflate_compute(true),
-    recompute_evals(!param.eig_param.preserve_evals)
+    recompute_evals(!param.eig_param.preserve_evals),
+    telemetry_solve(-1)
   {
     // compute parity of the node
     for (int i=0; i<4; i++) node_parity += commCoords(i);
@@ -155,6 +157,10 @@ namespace quda {
       report("CG3NR");
       solver = new CG3NR(mat, matSloppy, matPrecon, param, profile);
       break;
+    case QUDA_PIPELINED_CG_INVERTER:
+      report("PIPELINED CG");
+      solver = new PipelinedCG(mat, matSloppy, matPrecon, param, profile);
+      break;
     default:
       errorQuda("Invalid solver type %d", param.inv_type);
     }
@@ -369,6 +375,118 @@ namespace quda {
     if (std::isnan(r2)) errorQuda("Solver appears to have diverged");
   }
 
+  /*
+   * Solver telemetry is held in a ring buffer that, once full,
+   * overwrites the oldest records.  Solvers are only run from the
+   * host thread that drives QUDA, so no synchronization is needed.
+   */
+  static std::vector<QudaSolverTelemetryRecord> telemetry;
+  static size_t telemetry_head = 0; // total number of records ever pushed
+  static size_t telemetry_base = 0; // records before this have been flushed
+  static int telemetry_solves = 0;
+
+  /**
+     @return 0 if telemetry is disabled, 1 if it is recorded for
+     top-level solves, and 2 if it is also recorded for solvers acting
+     as preconditioners
+  */
+  static int solverTelemetryLevel()
+  {
+    static int level = -1;
+    if (level < 0) {
+      char *enable_env = getenv("QUDA_ENABLE_SOLVER_TELEMETRY");
+      level = enable_env ? atoi(enable_env) : 0;
+      if (level > 0) {
+        char *size_env = getenv("QUDA_SOLVER_TELEMETRY_SIZE");
+        int size = size_env ? atoi(size_env) : 65536;
+        if (size <= 0) errorQuda("Invalid QUDA_SOLVER_TELEMETRY_SIZE=%s", size_env);
+        telemetry.resize(size);
+      }
+    }
+    return level;
+  }
+
+  void Solver::RecordTelemetry(int k, double r2, double hq2, bool reliable_update)
+  {
+    int level = solverTelemetryLevel();
+    if (level == 0 || (param.is_preconditioner && level < 2)) return;
+
+    auto now = timeline::clock::now();
+    if ((k == 0 && !reliable_update) || telemetry_solve < 0) {
+      telemetry_solve = telemetry_solves++;
+      telemetry_start = now;
+    }
+
+    // the operator flop counters are only reset at the end of a solve, so peek rather than consume them
+    double flops = blas::flops;
+    const Dirac *dirac[] = {mat.Expose(), matSloppy.Expose(), matPrecon.Expose()};
+    for (int i = 0; i < 3; i++) {
+      bool counted = false;
+      for (int j = 0; j < i; j++) counted = counted || dirac[j] == dirac[i];
+      if (!counted) flops += dirac[i]->PeekFlops();
+    }
+
+    QudaSolverTelemetryRecord &record = telemetry[telemetry_head++ % telemetry.size()];
+    record.solve = telemetry_solve;
+    record.iter = k;
+    record.inv_type = param.inv_type;
+    record.reliable_update = reliable_update ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
+    record.precision = reliable_update ? param.precision : param.precision_sloppy;
+    record.preconditioner = param.is_preconditioner ? QUDA_BOOLEAN_TRUE : QUDA_BOOLEAN_FALSE;
+    record.r2 = r2;
+    record.hq2 = hq2;
+    record.time = std::chrono::duration<double>(now - telemetry_start).count();
+    record.flops = flops;
+  }
+
+  /** @return the index of the oldest record still held */
+  static size_t telemetryOldest()
+  {
+    return std::max(telemetry_base, telemetry_head > telemetry.size() ? telemetry_head - telemetry.size() : 0);
+  }
+
+  int getSolverTelemetry(QudaSolverTelemetryRecord *records, int n)
+  {
+    if (solverTelemetryLevel() == 0) return 0;
+    int count = 0;
+    for (size_t i = telemetryOldest(); i < telemetry_head && count < n; i++)
+      records[count++] = telemetry[i % telemetry.size()];
+    return count;
+  }
+
+  void saveSolverTelemetry(const char *filename)
+  {
+    if (solverTelemetryLevel() == 0) {
+      warningQuda("Solver telemetry is not enabled (set QUDA_ENABLE_SOLVER_TELEMETRY)");
+      return;
+    }
+
+    FILE *file = fopen(filename, "wb");
+    if (!file) errorQuda("Unable to open %s for writing the solver telemetry", filename);
+
+    const size_t oldest = telemetryOldest();
+    const char magic[8] = {'Q', 'U', 'D', 'A', 'S', 'T', 'E', 'L'};
+    const uint32_t header[4] = {1, sizeof(QudaSolverTelemetryRecord), static_cast<uint32_t>(telemetry_head - oldest),
+                                static_cast<uint32_t>(oldest - telemetry_base)};
+    bool success = fwrite(magic, sizeof(magic), 1, file) == 1 && fwrite(header, sizeof(header), 1, file) == 1;
+    for (size_t i = oldest; i < telemetry_head && success; i++)
+      success = fwrite(&telemetry[i % telemetry.size()], sizeof(QudaSolverTelemetryRecord), 1, file) == 1;
+    fclose(file);
+
+    if (!success) errorQuda("Failed to write the solver telemetry to %s", filename);
+    if (getVerbosity() >= QUDA_VERBOSE)
+      printfQuda("Saved %lu solver telemetry records to %s\n", telemetry_head - oldest, filename);
+  }
+
+  void flushSolverTelemetry() { telemetry_base = telemetry_head; }
+
+  void resetSolverTelemetry()
+  {
+    telemetry_head = 0;
+    telemetry_base = 0;
+    telemetry_solves = 0;
+  }
+
   void Solver::PrintSummary(const char *name, int k, double r2, double b2,
                             double r2_tol, double hq_tol) {
     if (getVerbosity() >= QUDA_SUMMARIZE) {
@@ -2,6 +2,8 @@
 #include <cstdio>
 #include <string>
 #include <map>
+#include <mutex>
+#include <vector>
 #include <unistd.h>   // for getpagesize()
 #include <execinfo.h> // for backtrace
 #include <quda_internal.h>
@@ -59,11 +61,17 @@ namespace quda
   };
 
   static std::map<void *, MemAlloc> alloc[N_ALLOC_TYPE];
+  // serializes the allocation tracking, since with the threaded comms backend the rank threads allocate concurrently
+  static std::mutex alloc_mutex;
   static long total_bytes[N_ALLOC_TYPE] = {0};
   static long max_total_bytes[N_ALLOC_TYPE] = {0};
   static long total_host_bytes, max_total_host_bytes;
   static long total_pinned_bytes, max_total_pinned_bytes;
 
+  // host memory pool statistics
+  static long host_pool_requests = 0, host_pool_reuses = 0;
+  static long host_pool_cached_bytes = 0, max_host_pool_cached_bytes = 0;
+
   long device_allocated_peak() { return max_total_bytes[DEVICE]; }
 
   long pinned_allocated_peak() { return max_total_bytes[PINNED]; }
@@ -113,6 +121,7 @@ namespace quda
 
   static void track_malloc(const AllocType &type, const MemAlloc &a, void *ptr)
   {
+    std::lock_guard<std::mutex> lock(alloc_mutex);
     total_bytes[type] += a.base_size;
     if (total_bytes[type] > max_total_bytes[type]) { max_total_bytes[type] = total_bytes[type]; }
     if (type != DEVICE && type != DEVICE_PINNED) {
@@ -128,6 +137,7 @@ namespace quda
 
   static void track_free(const AllocType &type, void *ptr)
   {
+    std::lock_guard<std::mutex> lock(alloc_mutex);
     size_t size = alloc[type][ptr].base_size;
     total_bytes[type] -= size;
     if (type != DEVICE && type != DEVICE_PINNED) { total_host_bytes -= size; }
@@ -135,6 +145,12 @@ namespace quda
     alloc[type].erase(ptr);
   }
 
+  static bool is_tracked(const AllocType &type, void *ptr)
+  {
+    std::lock_guard<std::mutex> lock(alloc_mutex);
+    return alloc[type].count(ptr);
+  }
+
   /**
    * Under CUDA 4.0, cudaHostRegister seems to require that both the
    * beginning and end of the buffer be aligned on page boundaries.
@@ -374,7 +390,7 @@ namespace quda
 
 #ifndef QDP_USE_CUDA_MANAGED_MEMORY
     if (!ptr) { errorQuda("Attempt to free NULL device pointer (%s:%d in %s())\n", file, line, func); }
-    if (!alloc[DEVICE].count(ptr)) {
+    if (!is_tracked(DEVICE, ptr)) {
       errorQuda("Attempt to free invalid device pointer (%s:%d in %s())\n", file, line, func);
     }
     cudaError_t err = cudaFree(ptr);
@@ -398,7 +414,7 @@ namespace quda
     }
 
     if (!ptr) { errorQuda("Attempt to free NULL device pointer (%s:%d in %s())\n", file, line, func); }
-    if (!alloc[DEVICE_PINNED].count(ptr)) {
+    if (!is_tracked(DEVICE_PINNED, ptr)) {
       errorQuda("Attempt to free invalid device pointer (%s:%d in %s())\n", file, line, func);
     }
     CUresult err = cuMemFree((CUdeviceptr)ptr);
@@ -414,7 +430,7 @@ namespace quda
   void managed_free_(const char *func, const char *file, int line, void *ptr)
   {
     if (!ptr) { errorQuda("Attempt to free NULL managed pointer (%s:%d in %s())\n", file, line, func); }
-    if (!alloc[MANAGED].count(ptr)) {
+    if (!is_tracked(MANAGED, ptr)) {
       errorQuda("Attempt to free invalid managed pointer (%s:%d in %s())\n", file, line, func);
     }
     cudaError_t err = cudaFree(ptr);
@@ -430,15 +446,15 @@ namespace quda
   void host_free_(const char *func, const char *file, int line, void *ptr)
   {
     if (!ptr) { errorQuda("Attempt to free NULL host pointer (%s:%d in %s())\n", file, line, func); }
-    if (alloc[HOST].count(ptr)) {
+    if (is_tracked(HOST, ptr)) {
       track_free(HOST, ptr);
       free(ptr);
-    } else if (alloc[PINNED].count(ptr)) {
+    } else if (is_tracked(PINNED, ptr)) {
       cudaError_t err = cudaHostUnregister(ptr);
       if (err != cudaSuccess) { errorQuda("Failed to unregister pinned memory (%s:%d in %s())\n", file, line, func); }
       track_free(PINNED, ptr);
       free(ptr);
-    } else if (alloc[MAPPED].count(ptr)) {
+    } else if (is_tracked(MAPPED, ptr)) {
 #ifdef HOST_ALLOC
       cudaError_t err = cudaFreeHost(ptr);
       if (err != cudaSuccess) { errorQuda("Failed to free host memory (%s:%d in %s())\n", file, line, func); }
@@ -464,10 +480,16 @@ namespace quda
     printfQuda("Managed memory used = %.1f MB\n", max_total_bytes[MANAGED] / (double)(1 << 20));
     printfQuda("Page-locked host memory used = %.1f MB\n", max_total_pinned_bytes / (double)(1 << 20));
     printfQuda("Total host memory used >= %.1f MB\n", max_total_host_bytes / (double)(1 << 20));
+    if (host_pool_requests > 0) {
+      printfQuda("Host memory pool: %ld allocations, %ld reused (%.1f%%), peak cached = %.1f MB\n", host_pool_requests,
+                 host_pool_reuses, 100.0 * host_pool_reuses / host_pool_requests,
+                 max_host_pool_cached_bytes / (double)(1 << 20));
+    }
   }
 
   void assertAllMemFree()
   {
+    std::lock_guard<std::mutex> lock(alloc_mutex);
     if (!alloc[DEVICE].empty() || !alloc[DEVICE_PINNED].empty() || !alloc[HOST].empty() || !alloc[PINNED].empty()
         || !alloc[MAPPED].empty()) {
       warningQuda("The following internal memory allocations were not freed.");
@@ -529,6 +551,24 @@ namespace quda
         in the cache). */
     static std::map<void *, size_t> deviceSize;
 
+    /** Cache of inactive host-memory allocations, binned by size
+        class.  Host allocations are requested with a wide range of
+        sizes, so rather than best-fit matching we round each request
+        up to a size class and only reuse allocations of that class. */
+    static std::map<size_t, std::vector<void *>> hostCache;
+
+    /** Size classes of active host-memory allocations. */
+    static std::map<void *, size_t> hostSize;
+
+    /** Host allocations may be made concurrently (e.g., by the rank
+        threads of the threaded comms backend), so the host cache,
+        its bookkeeping and statistics are guarded by this lock. */
+    static std::mutex host_pool_mutex;
+
+    /** Upper bound on the bytes held in the host cache; frees that
+        would exceed it release the allocation instead */
+    static size_t host_pool_limit = 0;
+
     static bool pool_init = false;
 
     /** whether to use a memory pool allocator for device memory */
@@ -537,6 +577,10 @@ namespace quda
     /** whether to use a memory pool allocator for pinned memory */
     static bool pinned_memory_pool = true;
 
+    /** whether to use a memory pool allocator for host memory (off
+        until init() has been called) */
+    static bool host_memory_pool = false;
+
     void init()
     {
       if (!pool_init) {
@@ -559,6 +603,22 @@ namespace quda
           warningQuda("Not using pinned memory pool allocator");
           pinned_memory_pool = false;
         }
+
+        // host memory pool
+        char *enable_host_pool = getenv("QUDA_ENABLE_HOST_MEMORY_POOL");
+        if (!enable_host_pool || strcmp(enable_host_pool, "0") != 0) {
+          warningQuda("Using host memory pool allocator");
+          host_memory_pool = true;
+
+          // cap on the cached host memory in MiB, default 1 GiB
+          char *limit_env = getenv("QUDA_HOST_MEMORY_POOL_LIMIT");
+          long limit = limit_env ? atol(limit_env) : 1024;
+          if (limit < 0) errorQuda("Invalid QUDA_HOST_MEMORY_POOL_LIMIT=%s", limit_env);
+          host_pool_limit = static_cast<size_t>(limit) << 20;
+        } else {
+          warningQuda("Not using host memory pool allocator");
+          host_memory_pool = false;
+        }
         pool_init = true;
       }
     }
@@ -643,6 +703,76 @@ namespace quda
       }
     }
 
+    /**
+       @brief Round a host allocation request up to its size class.
+       Requests up to 256 bytes share a single class, and above that
+       each power of two is split into four classes, bounding the
+       wasted space to 25% of the request.
+       @param nbytes Requested size
+       @return Size of the class the request belongs to
+    */
+    static size_t host_size_class(size_t nbytes)
+    {
+      constexpr size_t min_class = 256;
+      if (nbytes <= min_class) return min_class;
+      size_t msb = 1;
+      while ((msb << 1) <= nbytes) msb <<= 1;
+      const size_t step = msb / 4;
+      return ((nbytes + step - 1) / step) * step;
+    }
+
+    void *host_malloc_(const char *func, const char *file, int line, size_t nbytes)
+    {
+      void *ptr = nullptr;
+      if (host_memory_pool) {
+        const size_t size = host_size_class(nbytes);
+        std::lock_guard<std::mutex> lock(host_pool_mutex);
+        host_pool_requests++;
+
+        auto it = hostCache.find(size);
+        if (it != hostCache.end() && !it->second.empty()) {
+          ptr = it->second.back();
+          it->second.pop_back();
+          host_pool_cached_bytes -= size;
+          host_pool_reuses++;
+        } else {
+          ptr = quda::safe_malloc_(func, file, line, size);
+        }
+        hostSize[ptr] = size;
+      } else {
+        ptr = quda::safe_malloc_(func, file, line, nbytes);
+      }
+      return ptr;
+    }
+
+    void host_free_(const char *func, const char *file, int line, void *ptr)
+    {
+      if (!host_memory_pool) {
+        quda::host_free_(func, file, line, ptr);
+        return;
+      }
+
+      std::lock_guard<std::mutex> lock(host_pool_mutex);
+      auto it = hostSize.find(ptr);
+      if (it == hostSize.end()) {
+        // allocations made before the pool was enabled are released directly
+        quda::host_free_(func, file, line, ptr);
+        return;
+      }
+
+      const size_t size = it->second;
+      hostSize.erase(it);
+      if (static_cast<size_t>(host_pool_cached_bytes) + size > host_pool_limit) {
+        // the cache is full so release the allocation for real
+        quda::host_free_(func, file, line, ptr);
+        return;
+      }
+
+      hostCache[size].push_back(ptr);
+      host_pool_cached_bytes += size;
+      if (host_pool_cached_bytes > max_host_pool_cached_bytes) max_host_pool_cached_bytes = host_pool_cached_bytes;
+    }
+
     void flush_pinned()
     {
       if (pinned_memory_pool) {
@@ -667,6 +797,18 @@ namespace quda
       }
     }
 
+    void flush_host()
+    {
+      if (host_memory_pool) {
+        std::lock_guard<std::mutex> lock(host_pool_mutex);
+        for (auto &bin : hostCache) {
+          for (auto ptr : bin.second) host_free(ptr);
+        }
+        hostCache.clear();
+        host_pool_cached_bytes = 0;
+      }
+    }
+
   } // namespace pool
 
 } // namespace quda
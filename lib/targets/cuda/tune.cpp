@@ -2,6 +2,9 @@
 #include <comm_quda.h>
 #include <quda.h>     // for QUDA_VERSION_STRING
 #include <sys/stat.h> // for stat()
+#include <sys/mman.h> // for mmap()
+#include <sys/file.h> // for flock()
+#include <dirent.h>
 #include <fcntl.h>
 #include <cfloat> // for FLT_MAX
 #include <ctime>
@@ -9,12 +12,23 @@
 #include <typeinfo>
 #include <map>
 #include <list>
+#include <vector>
+#include <cstdint>
 #include <unistd.h>
 #include <uint_to_char.h>
 
 #include <deque>
 #include <queue>
 #include <functional>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 //#define LAUNCH_TIMER
 extern char *gitversion;
@@ -31,74 +45,462 @@ namespace quda
 {
   typedef std::map<TuneKey, TuneParam> map;
 
-  struct TraceKey {
+  static int enable_trace = 0;
 
-    TuneKey key;
-    float time;
+  int traceEnabled()
+  {
+    static bool init = false;
 
-    long device_bytes;
-    long pinned_bytes;
-    long mapped_bytes;
-    long host_bytes;
+    if (!init) {
+      char *enable_trace_env = getenv("QUDA_ENABLE_TRACE");
+      if (enable_trace_env) {
+        if (strcmp(enable_trace_env, "1") == 0) {
+          // only explicitly posted trace events are included
+          enable_trace = 1;
+        } else if (strcmp(enable_trace_env, "2") == 0) {
+          // enable full kernel trace and posted trace events
+          enable_trace = 2;
+        }
+      }
+      init = true;
+    }
+    return enable_trace;
+  }
 
-    TraceKey() {}
+  static const std::string quda_hash = QUDA_HASH; // defined in lib/Makefile
+  static std::string resource_path;
+  static map tunecache;
+  static size_t initial_cache_size = 0;
 
-    TraceKey(const TuneKey &key, float time) :
-      key(key),
-      time(time),
-      device_bytes(device_allocated_peak()),
-      pinned_bytes(pinned_allocated_peak()),
-      mapped_bytes(mapped_allocated_peak()),
-      host_bytes(host_allocated_peak())
+  /** whether tunecache.bin on disk is up to date with the in-memory tunecache */
+  static bool binary_cache_current = false;
+
+  /**
+     @brief 64-bit FNV-1a hash of a TuneKey.  A separator is mixed in
+     after each string so that keys that only differ by where the
+     strings are split do not collide.
+  */
+  static uint64_t tuneKeyHash(const TuneKey &key)
+  {
+    constexpr uint64_t prime = 1099511628211ull;
+    uint64_t hash = 14695981039346656037ull;
+    for (const char *str : {key.volume, key.name, key.aux}) {
+      for (const char *c = str; *c; c++) {
+        hash ^= static_cast<unsigned char>(*c);
+        hash *= prime;
+      }
+      hash ^= 0xff;
+      hash *= prime;
+    }
+    return hash;
+  }
+
+  static inline bool tuneKeyEqual(const TuneKey &a, const TuneKey &b)
+  {
+    return strcmp(a.volume, b.volume) == 0 && strcmp(a.name, b.name) == 0 && strcmp(a.aux, b.aux) == 0;
+  }
+
+  /**
+     @brief Open-addressing (linear probing) hash index into the
+     tunecache map.  std::map never invalidates references on
+     insertion, so the index holds pointers to the map entries
+     together with their hash; a lookup then costs a single key
+     comparison rather than a tree walk of string comparisons.
+  */
+  class TuneCacheIndex
+  {
+    struct Slot {
+      uint64_t hash;
+      map::value_type *entry; // nullptr denotes an empty slot
+    };
+
+    std::vector<Slot> slots;
+    size_t n_entry = 0;
+
+    void grow()
     {
+      std::vector<Slot> old(slots.size() ? 2 * slots.size() : 1024, Slot {0, nullptr});
+      std::swap(old, slots);
+      n_entry = 0;
+      for (auto &slot : old)
+        if (slot.entry) insert(slot.entry, slot.hash);
     }
 
-    TraceKey(const TraceKey &trace) :
-      key(trace.key),
-      time(trace.time),
-      device_bytes(trace.device_bytes),
-      pinned_bytes(trace.pinned_bytes),
-      mapped_bytes(trace.mapped_bytes),
-      host_bytes(trace.host_bytes)
+  public:
+    void clear()
     {
+      slots.clear();
+      n_entry = 0;
     }
 
-    TraceKey &operator=(const TraceKey &trace)
+    map::value_type *find(const TuneKey &key, uint64_t hash) const
     {
-      if (&trace != this) {
-        key = trace.key;
-        time = trace.time;
-        device_bytes = trace.device_bytes;
-        pinned_bytes = trace.pinned_bytes;
-        mapped_bytes = trace.mapped_bytes;
-        host_bytes = trace.host_bytes;
+      if (slots.empty()) return nullptr;
+      const size_t mask = slots.size() - 1;
+      for (size_t i = hash & mask;; i = (i + 1) & mask) {
+        const Slot &slot = slots[i];
+        if (!slot.entry) return nullptr;
+        if (slot.hash == hash && tuneKeyEqual(slot.entry->first, key)) return slot.entry;
       }
-      return *this;
+    }
+
+    void insert(map::value_type *entry, uint64_t hash)
+    {
+      if (2 * (n_entry + 1) > slots.size()) grow(); // keep the load factor at or below 1/2
+      const size_t mask = slots.size() - 1;
+      size_t i = hash & mask;
+      while (slots[i].entry) i = (i + 1) & mask;
+      slots[i] = {hash, entry};
+      n_entry++;
     }
   };
 
-  // linked list that is augmented each time we call a kernel
-  static std::list<TraceKey> trace_list;
-  static int enable_trace = 0;
+  static TuneCacheIndex tunecache_index;
 
-  int traceEnabled()
+  /**
+     @brief Insert (or overwrite) an entry in the tunecache, keeping
+     the hash index in sync
+     @param[in] key Key of the entry
+     @param[in] param Launch parameters to store
+     @param[in] hash Precomputed hash of key
+     @return Reference to the stored parameters
+  */
+  static TuneParam &insertTuneCache(const TuneKey &key, const TuneParam &param, uint64_t hash)
   {
-    static bool init = false;
+    auto entry = tunecache_index.find(key, hash);
+    if (entry) {
+      entry->second = param;
+    } else {
+      entry = &*tunecache.insert(std::make_pair(key, param)).first;
+      tunecache_index.insert(entry, hash);
+    }
+    return entry->second;
+  }
 
-    if (!init) {
-      char *enable_trace_env = getenv("QUDA_ENABLE_TRACE");
-      if (enable_trace_env) {
-        if (strcmp(enable_trace_env, "1") == 0) {
-          // only explicitly posted trace events are included
-          enable_trace = 1;
-        } else if (strcmp(enable_trace_env, "2") == 0) {
-          // enable full kernel trace and posted trace events
-          enable_trace = 2;
+  /**
+     @brief Merge an entry into the tunecache: a key that is already
+     present is only overwritten if the new launch parameters are
+     faster
+     @param[in] key Key of the entry
+     @param[in] param Launch parameters to merge
+     @param[in] hash Precomputed hash of key
+     @return Whether the tunecache was modified
+  */
+  static bool mergeTuneParam(const TuneKey &key, const TuneParam &param, uint64_t hash)
+  {
+    auto entry = tunecache_index.find(key, hash);
+    if (entry && entry->second.time <= param.time) return false;
+    insertTuneCache(key, param, hash);
+    binary_cache_current = false;
+    return true;
+  }
+
+  /** entries tuned on this process that have yet to be gathered to process 0 */
+  static std::vector<const map::value_type *> local_entries;
+
+  /** flops and bytes accumulated over the profiled launches of a tunecache entry, for the roofline report */
+  struct RooflineCount {
+    double flops = 0.0;
+    double bytes = 0.0;
+  };
+
+  static std::unordered_map<const map::value_type *, RooflineCount> roofline_counts;
+
+  const TuneParam *findTuneParam(const TuneKey &key)
+  {
+    auto entry = tunecache_index.find(key, tuneKeyHash(key));
+    return entry ? &entry->second : nullptr;
+  }
+
+  void clearTuneCache()
+  {
+    local_entries.clear();
+    roofline_counts.clear();
+    tunecache_index.clear();
+    tunecache.clear();
+    initial_cache_size = 0;
+    binary_cache_current = false;
+  }
+
+#define STR_(x) #x
+#define STR(x) STR_(x)
+  static const std::string quda_version
+    = STR(QUDA_VERSION_MAJOR) "." STR(QUDA_VERSION_MINOR) "." STR(QUDA_VERSION_SUBMINOR);
+#undef STR
+#undef STR_
+
+  /*
+   * Kernel trace (QUDA_ENABLE_TRACE).  Rather than accumulating the
+   * trace in memory, which grows without bound on long runs, the
+   * launching thread pushes compact fixed-size records onto a bounded
+   * single-producer / single-consumer ring buffer, and a background
+   * thread streams them to a binary trace file.  Each distinct TuneKey
+   * is interned and written to the file once, the first time it is
+   * referenced, with launch records referring to it by id.  Use the
+   * trace_decode utility to convert the binary trace to TSV.
+   */
+  static const char trace_magic[8] = {'Q', 'U', 'D', 'A', 'T', 'R', 'C', 'E'};
+  static constexpr uint32_t trace_format_version = 1;
+
+  enum TraceEntryType : uint32_t { TRACE_ENTRY_KEY = 1, TRACE_ENTRY_LAUNCH = 2 };
+
+  struct TraceFileHeader {
+    char magic[8];
+    uint32_t format_version;
+    uint32_t key_bytes;
+    uint32_t launch_bytes;
+    uint32_t version_bytes; // length of the "version\tgit version\tbuild hash" string that follows
+  };
+
+  struct TraceKeyEntry {
+    uint32_t type;
+    uint32_t id;
+    char volume[TuneKey::volume_n];
+    char name[TuneKey::name_n];
+    char aux[TuneKey::aux_n];
+  };
+
+  struct TraceLaunchEntry {
+    uint32_t type;
+    uint32_t key_id;
+    float time;
+    uint32_t reserved;
+    int64_t device_bytes;
+    int64_t pinned_bytes;
+    int64_t mapped_bytes;
+    int64_t host_bytes;
+  };
+
+  // the trace writer drains once this many records are pending, and also drains and flushes to disk at the
+  // interval, so that little of the trace is lost if the job is killed
+  static constexpr size_t trace_drain_threshold = 256;
+  static constexpr std::chrono::milliseconds trace_drain_interval {100};
+
+  class TraceStream
+  {
+    std::vector<TraceLaunchEntry> ring;
+    size_t mask = 0;
+    std::atomic<size_t> head {0}; // written by the producer
+    std::atomic<size_t> tail {0}; // written by the writer thread
+
+    // interned keys: appended by the producer and read by the writer under key_mutex, the lookup is producer only
+    std::mutex key_mutex;
+    std::deque<TuneKey> keys;
+    std::unordered_multimap<uint64_t, uint32_t> key_ids;
+    uint32_t keys_written = 0;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool stopping = false;
+    size_t flush_target = 0;
+    size_t drain_threshold = 1; // the producer wakes the writer once this many records are pending
+    std::thread writer;
+
+    FILE *file = nullptr;
+    std::string path;
+
+    uint32_t intern(const TuneKey &key, uint64_t hash)
+    {
+      auto range = key_ids.equal_range(hash);
+      for (auto it = range.first; it != range.second; it++)
+        if (tuneKeyEqual(keys[it->second], key)) return it->second;
+
+      std::lock_guard<std::mutex> lock(key_mutex);
+      uint32_t id = keys.size();
+      keys.push_back(key);
+      key_ids.emplace(hash, id);
+      return id;
+    }
+
+    /** write the definitions of all keys up to and including id, if not already written */
+    void writeKeys(uint32_t id)
+    {
+      std::lock_guard<std::mutex> lock(key_mutex);
+      for (; keys_written <= id; keys_written++) {
+        TraceKeyEntry entry;
+        memset(&entry, 0, sizeof(entry));
+        entry.type = TRACE_ENTRY_KEY;
+        entry.id = keys_written;
+        const TuneKey &key = keys[keys_written];
+        strcpy(entry.volume, key.volume);
+        strcpy(entry.name, key.name);
+        strcpy(entry.aux, key.aux);
+        fwrite(&entry, sizeof(entry), 1, file);
+      }
+    }
+
+    /** drain the ring buffer to the file, @return the number of records written */
+    size_t drain()
+    {
+      size_t t = tail.load(std::memory_order_relaxed);
+      size_t h = head.load(std::memory_order_acquire);
+      for (size_t i = t; i < h; i++) {
+        const TraceLaunchEntry &entry = ring[i & mask];
+        if (entry.key_id >= keys_written) writeKeys(entry.key_id);
+        fwrite(&entry, sizeof(entry), 1, file);
+      }
+      tail.store(h, std::memory_order_release);
+      return h - t;
+    }
+
+    size_t pending() const { return head.load(std::memory_order_acquire) - tail.load(std::memory_order_relaxed); }
+
+    void run()
+    {
+      auto last_flush = std::chrono::steady_clock::now();
+      std::unique_lock<std::mutex> lock(mutex);
+      while (true) {
+        lock.unlock();
+        drain();
+        const auto now = std::chrono::steady_clock::now();
+        if (now - last_flush >= trace_drain_interval) {
+          fflush(file);
+          last_flush = now;
+        }
+        lock.lock();
+        if (flush_target > 0 && tail.load(std::memory_order_relaxed) >= flush_target) {
+          fflush(file);
+          flush_target = 0;
+          wake.notify_all();
         }
+        if (stopping && pending() == 0) break;
+        // sleep until records are pending, we are asked to flush or stop, or the drain interval has passed
+        wake.wait_for(lock, trace_drain_interval,
+                      [this] { return stopping || flush_target > 0 || pending() >= drain_threshold; });
       }
-      init = true;
     }
-    return enable_trace;
+
+  public:
+    bool active() const { return file != nullptr; }
+    const std::string &filename() const { return path; }
+
+    /**
+       @brief Open the trace file and start the writer thread
+       @param[in] path Path of the binary trace file
+       @param[in] capacity Number of records the ring buffer holds (rounded up to a power of two)
+    */
+    void start(const std::string &path, size_t capacity)
+    {
+      file = fopen(path.c_str(), "wb");
+      if (!file) {
+        warningQuda("Unable to open %s for writing the trace", path.c_str());
+        return;
+      }
+      this->path = path;
+
+      size_t size = 1;
+      while (size < capacity) size <<= 1;
+      ring.resize(size);
+      mask = size - 1;
+      drain_threshold = size > 1 ? (size / 2 < trace_drain_threshold ? size / 2 : trace_drain_threshold) : 1;
+
+      std::string version = quda_version + "\t";
+#ifdef GITVERSION
+      version += gitversion;
+#else
+      version += quda_version;
+#endif
+      version += "\t" + quda_hash;
+
+      TraceFileHeader header = {};
+      memcpy(header.magic, trace_magic, sizeof(trace_magic));
+      header.format_version = trace_format_version;
+      header.key_bytes = sizeof(TraceKeyEntry);
+      header.launch_bytes = sizeof(TraceLaunchEntry);
+      header.version_bytes = version.size();
+      fwrite(&header, sizeof(header), 1, file);
+      fwrite(version.c_str(), version.size(), 1, file);
+
+      writer = std::thread(&TraceStream::run, this);
+    }
+
+    /**
+       @brief Push a record onto the ring buffer.  This must only be
+       called from a single thread, the one that launches kernels.
+       If the ring buffer is full we wait for the writer to catch up.
+    */
+    void push(const TuneKey &key, uint64_t hash, float time)
+    {
+      TraceLaunchEntry entry;
+      entry.type = TRACE_ENTRY_LAUNCH;
+      entry.key_id = intern(key, hash);
+      entry.time = time;
+      entry.reserved = 0;
+      entry.device_bytes = device_allocated_peak();
+      entry.pinned_bytes = pinned_allocated_peak();
+      entry.mapped_bytes = mapped_allocated_peak();
+      entry.host_bytes = host_allocated_peak();
+
+      size_t h = head.load(std::memory_order_relaxed);
+      while (h - tail.load(std::memory_order_acquire) > mask) std::this_thread::yield();
+      ring[h & mask] = entry;
+      head.store(h + 1, std::memory_order_release);
+
+      // wake the writer as the buffer reaches the threshold; the lock ensures the wakeup cannot be missed
+      if (h + 1 - tail.load(std::memory_order_acquire) == drain_threshold) {
+        { std::lock_guard<std::mutex> lock(mutex); }
+        wake.notify_all();
+      }
+    }
+
+    /** @brief Wait until all records pushed so far have been written to disk */
+    void flush()
+    {
+      if (!active()) return;
+      std::unique_lock<std::mutex> lock(mutex);
+      flush_target = head.load(std::memory_order_relaxed);
+      if (flush_target == 0) return;
+      wake.notify_all();
+      wake.wait(lock, [this] { return flush_target == 0; });
+    }
+
+    /** @brief Write out all outstanding records, stop the writer thread and close the file */
+    void stop()
+    {
+      if (!active()) return;
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+      }
+      wake.notify_all();
+      writer.join();
+      fclose(file);
+      file = nullptr;
+      stopping = false;
+    }
+
+    /** Stop the writer if the trace was never ended, e.g., on exit() or errorQuda(), since destroying a joinable
+        std::thread calls std::terminate */
+    ~TraceStream() { stop(); }
+  };
+
+  static TraceStream trace_stream;
+  static bool trace_started = false; // the trace is started on first use after initQuda
+  static int trace_session = 0;      // number of traces started by this process
+
+  /**
+     @brief Record a kernel launch (or posted event) in the trace,
+     starting the trace stream on first use.  The trace is only
+     recorded on node 0, which is the node that saves the profile.
+  */
+  static void traceLaunch(const TuneKey &key, uint64_t hash, float time)
+  {
+    if (!trace_stream.active()) {
+      if (trace_started || resource_path.empty() || comm_rank() != 0) return;
+      trace_started = true;
+
+      char *capacity_env = getenv("QUDA_TRACE_BUFFER_SIZE");
+      size_t capacity = capacity_env ? strtoul(capacity_env, nullptr, 10) : 65536;
+      if (capacity == 0) errorQuda("Invalid QUDA_TRACE_BUFFER_SIZE=%s", capacity_env);
+
+      char *profile_fname = getenv("QUDA_PROFILE_OUTPUT_BASE");
+      std::string trace_path = resource_path + "/" + (profile_fname ? std::string(profile_fname) + "_trace" : "trace")
+        + "_" + std::to_string(getpid()) + (trace_session > 0 ? "_" + std::to_string(trace_session) : "") + ".bin";
+      trace_session++;
+      trace_stream.start(trace_path, capacity);
+      if (!trace_stream.active()) return;
+    }
+    trace_stream.push(key, hash, time);
   }
 
   void postTrace_(const char *func, const char *file, int line)
@@ -111,29 +513,129 @@ namespace quda
       i32toa(tmp, line);
       strcat(aux, tmp);
       TuneKey key("", func, aux);
-      TraceKey trace_entry(key, 0.0);
-      trace_list.push_back(trace_entry);
+      traceLaunch(key, tuneKeyHash(key), 0.0);
     }
   }
 
-  static const std::string quda_hash = QUDA_HASH; // defined in lib/Makefile
-  static std::string resource_path;
-  static map tunecache;
-  static map::iterator it;
-  static size_t initial_cache_size = 0;
+  void endTrace()
+  {
+    trace_stream.stop();
+    trace_started = false;
+  }
 
-#define STR_(x) #x
-#define STR(x) STR_(x)
-  static const std::string quda_version
-    = STR(QUDA_VERSION_MAJOR) "." STR(QUDA_VERSION_MINOR) "." STR(QUDA_VERSION_SUBMINOR);
-#undef STR
-#undef STR_
+  /**
+   * Serialize a trace entry as TSV, as the trace was written before
+   * it was streamed in binary form.
+   */
+  static void serializeTrace(std::ostream &out, const TuneKey &key, const TraceLaunchEntry &entry)
+  {
+    // special case kernel members of a policy
+    char tmp[TuneKey::aux_n] = {};
+    strncpy(tmp, key.aux, TuneKey::aux_n);
+    bool is_policy_kernel = strcmp(tmp, "policy_kernel") == 0 ? true : false;
+
+    out << std::setw(12) << entry.time << "\t";
+    out << std::setw(12) << entry.device_bytes << "\t";
+    out << std::setw(12) << entry.pinned_bytes << "\t";
+    out << std::setw(12) << entry.mapped_bytes << "\t";
+    out << std::setw(12) << entry.host_bytes << "\t";
+    out << std::setw(16) << key.volume << "\t";
+    if (is_policy_kernel) out << "\t";
+    out << key.name << "\t";
+    if (!is_policy_kernel) out << "\t";
+    out << key.aux << std::endl;
+  }
+
+  bool decodeTrace(const std::string &path, std::ostream &out)
+  {
+    FILE *file = fopen(path.c_str(), "rb");
+    if (!file) return false;
+
+    TraceFileHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, trace_magic, sizeof(trace_magic)) != 0
+        || header.format_version != trace_format_version || header.key_bytes != sizeof(TraceKeyEntry)
+        || header.launch_bytes != sizeof(TraceLaunchEntry)) {
+      fclose(file);
+      errorQuda("%s is not a QUDA trace file of format version %u", path.c_str(), trace_format_version);
+    }
+
+    std::string version(header.version_bytes, '\0');
+    if (fread(&version[0], 1, version.size(), file) != version.size()) {
+      fclose(file);
+      errorQuda("Truncated header in trace file %s", path.c_str());
+    }
+
+    struct stat file_stat;
+    time_t updated = fstat(fileno(file), &file_stat) == 0 ? file_stat.st_mtime : time(nullptr);
+
+    out << "trace\t" << version << "\t# Last updated " << ctime(&updated) << std::endl;
+    out << std::setw(12) << "time\t" << std::setw(12) << "device-mem\t" << std::setw(12) << "pinned-mem\t";
+    out << std::setw(12) << "mapped-mem\t" << std::setw(12) << "host-mem\t";
+    out << std::setw(16) << "volume"
+        << "\tname\taux" << std::endl;
+
+    std::vector<TuneKey> keys;
+    uint32_t type;
+    // a trace left by a job that was killed may end with a partial entry, which we ignore
+    while (fread(&type, sizeof(type), 1, file) == 1) {
+      if (type == TRACE_ENTRY_KEY) {
+        TraceKeyEntry entry;
+        entry.type = type;
+        if (fread(reinterpret_cast<char *>(&entry) + sizeof(type), sizeof(entry) - sizeof(type), 1, file) != 1) break;
+        if (entry.id != keys.size()) errorQuda("Unexpected key id %u in trace file %s", entry.id, path.c_str());
+        entry.volume[TuneKey::volume_n - 1] = entry.name[TuneKey::name_n - 1] = entry.aux[TuneKey::aux_n - 1] = '\0';
+        keys.emplace_back(entry.volume, entry.name, entry.aux);
+      } else if (type == TRACE_ENTRY_LAUNCH) {
+        TraceLaunchEntry entry;
+        entry.type = type;
+        if (fread(reinterpret_cast<char *>(&entry) + sizeof(type), sizeof(entry) - sizeof(type), 1, file) != 1) break;
+        if (entry.key_id >= keys.size()) errorQuda("Undefined key id %u in trace file %s", entry.key_id, path.c_str());
+        serializeTrace(out, keys[entry.key_id], entry);
+      } else {
+        fclose(file);
+        errorQuda("Corrupt entry of type %u in trace file %s", type, path.c_str());
+      }
+    }
+
+    fclose(file);
+    return true;
+  }
 
   /** tuning in progress? */
   static bool tuning = false;
 
   bool activeTuning() { return tuning; }
 
+  // chunk sizes tried by advanceHostTuneParam, with 0 denoting a contiguous partition
+  static constexpr int host_chunk_min = 256;
+  static constexpr int host_chunk_max = 16384;
+
+  void initHostTuneParam(TuneParam &param)
+  {
+#ifdef _OPENMP
+    param.aux.x = omp_get_max_threads();
+#else
+    param.aux.x = 1;
+#endif
+    param.aux.y = 0;
+  }
+
+  bool advanceHostTuneParam(TuneParam &param)
+  {
+    if (param.aux.y == 0) {
+      param.aux.y = host_chunk_min;
+      return true;
+    } else if (param.aux.y < host_chunk_max) {
+      param.aux.y *= 4;
+      return true;
+    } else if (param.aux.x > 1) {
+      param.aux.x /= 2;
+      param.aux.y = 0;
+      return true;
+    }
+    return false;
+  }
+
   static bool profile_count = true;
 
   void disableProfileCount() { profile_count = false; }
@@ -143,8 +645,9 @@ namespace quda
 
   /**
    * Deserialize tunecache from an istream, useful for reading a file or receiving from other nodes.
+   * @param[in] merge Whether to merge entries by best time rather than overwrite existing ones
    */
-  static void deserializeTuneCache(std::istream &in)
+  static void deserializeTuneCache(std::istream &in, bool merge)
   {
     std::string line;
     std::stringstream ls;
@@ -175,7 +678,10 @@ namespace quda
       ls.ignore(1);               // throw away tab before comment
       getline(ls, param.comment); // assume anything remaining on the line is a comment
       param.comment += "\n";      // our convention is to include the newline, since ctime() likes to do this
-      tunecache[key] = param;
+      if (merge)
+        mergeTuneParam(key, param, tuneKeyHash(key));
+      else
+        insertTuneCache(key, param, tuneKeyHash(key));
     }
   }
 
@@ -199,6 +705,395 @@ namespace quda
     }
   }
 
+  /*
+   * Binary tunecache layout: a header, followed by n_entry fixed-size
+   * records, followed by a table of null-terminated strings that the
+   * header and records refer to by offset.  The format is native
+   * endian and is versioned through format_version and record_bytes;
+   * the human-readable tunecache.tsv is still written alongside it.
+   */
+  static constexpr char tunecache_magic[8] = {'Q', 'U', 'D', 'A', 'T', 'U', 'N', 'E'};
+  static constexpr uint32_t tunecache_format_version = 1;
+
+  struct TuneCacheString {
+    uint32_t offset;
+    uint32_t length; // excluding the null terminator
+  };
+
+  struct TuneCacheHeader {
+    char magic[8];
+    uint32_t format_version;
+    uint32_t record_bytes;
+    uint64_t n_entry;
+    uint64_t string_bytes;
+    TuneCacheString version;
+    TuneCacheString git_version;
+    TuneCacheString build_hash;
+  };
+
+  struct TuneCacheRecord {
+    uint64_t hash;
+    TuneCacheString volume;
+    TuneCacheString name;
+    TuneCacheString aux;
+    TuneCacheString comment;
+    int32_t block[3];
+    int32_t grid[3];
+    int32_t shared_bytes;
+    int32_t param_aux[4];
+    float time;
+  };
+
+  static TuneCacheString appendString(std::vector<char> &strings, const char *str, size_t length)
+  {
+    TuneCacheString s = {static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(length)};
+    strings.insert(strings.end(), str, str + length);
+    strings.push_back('\0');
+    return s;
+  }
+
+  static TuneCacheString appendString(std::vector<char> &strings, const std::string &str)
+  {
+    return appendString(strings, str.c_str(), str.length());
+  }
+
+  /**
+   * Serialize a set of tunecache entries to a binary buffer, useful for writing to a file or sending to other nodes.
+   */
+  static void serializeTuneCacheBinary(std::vector<char> &buffer, const std::vector<const map::value_type *> &entries)
+  {
+    std::vector<char> strings;
+    std::vector<TuneCacheRecord> records;
+    records.reserve(entries.size());
+
+    TuneCacheHeader header = {};
+    memcpy(header.magic, tunecache_magic, sizeof(tunecache_magic));
+    header.format_version = tunecache_format_version;
+    header.record_bytes = sizeof(TuneCacheRecord);
+    header.n_entry = entries.size();
+    header.version = appendString(strings, quda_version);
+#ifdef GITVERSION
+    header.git_version = appendString(strings, gitversion, strlen(gitversion));
+#else
+    header.git_version = appendString(strings, quda_version);
+#endif
+    header.build_hash = appendString(strings, quda_hash);
+
+    for (auto entry : entries) {
+      const TuneKey &key = entry->first;
+      const TuneParam &param = entry->second;
+      TuneCacheRecord record;
+      record.hash = tuneKeyHash(key);
+      record.volume = appendString(strings, key.volume, strlen(key.volume));
+      record.name = appendString(strings, key.name, strlen(key.name));
+      record.aux = appendString(strings, key.aux, strlen(key.aux));
+      record.comment = appendString(strings, param.comment);
+      record.block[0] = param.block.x;
+      record.block[1] = param.block.y;
+      record.block[2] = param.block.z;
+      record.grid[0] = param.grid.x;
+      record.grid[1] = param.grid.y;
+      record.grid[2] = param.grid.z;
+      record.shared_bytes = param.shared_bytes;
+      record.param_aux[0] = param.aux.x;
+      record.param_aux[1] = param.aux.y;
+      record.param_aux[2] = param.aux.z;
+      record.param_aux[3] = param.aux.w;
+      record.time = param.time;
+      records.push_back(record);
+    }
+    header.string_bytes = strings.size();
+
+    const size_t record_bytes = records.size() * sizeof(TuneCacheRecord);
+    buffer.resize(sizeof(TuneCacheHeader) + record_bytes + strings.size());
+    memcpy(buffer.data(), &header, sizeof(TuneCacheHeader));
+    if (record_bytes) memcpy(buffer.data() + sizeof(TuneCacheHeader), records.data(), record_bytes);
+    memcpy(buffer.data() + sizeof(TuneCacheHeader) + record_bytes, strings.data(), strings.size());
+  }
+
+  /**
+   * Serialize the entire tunecache to a binary buffer.
+   */
+  static void serializeTuneCacheBinary(std::vector<char> &buffer)
+  {
+    std::vector<const map::value_type *> entries;
+    entries.reserve(tunecache.size());
+    for (auto &entry : tunecache) entries.push_back(&entry);
+    serializeTuneCacheBinary(buffer, entries);
+  }
+
+  static void appendTuneJournal(const TuneKey &key, const TuneParam &param, uint64_t hash);
+
+  /**
+   * Deserialize tunecache from a binary buffer, e.g., a memory-mapped file or a buffer received from other nodes.
+   * @param[in] buffer Serialized tunecache
+   * @param[in] bytes Size of buffer
+   * @param[in] version_check Whether to reject a buffer written by a different QUDA version or build
+   * @param[in] source Description of the buffer used in warnings
+   * @param[in] merge Whether to merge entries by best time rather than overwrite existing ones
+   * @param[in] journal Whether to append the merged entries that modified the tunecache to the journal
+   * @return Whether the buffer was accepted
+   */
+  static bool deserializeTuneCacheBinary(const char *buffer, size_t bytes, bool version_check, const char *source,
+                                         bool merge, bool journal = false)
+  {
+    TuneCacheHeader header;
+    if (bytes < sizeof(TuneCacheHeader)) {
+      warningQuda("Truncated binary tunecache %s", source);
+      return false;
+    }
+    memcpy(&header, buffer, sizeof(TuneCacheHeader));
+
+    if (memcmp(header.magic, tunecache_magic, sizeof(tunecache_magic)) || header.format_version != tunecache_format_version
+        || header.record_bytes != sizeof(TuneCacheRecord)) {
+      warningQuda("Binary tunecache %s has an unrecognized format", source);
+      return false;
+    }
+
+    if (header.n_entry > bytes / sizeof(TuneCacheRecord)
+        || bytes != sizeof(TuneCacheHeader) + header.n_entry * sizeof(TuneCacheRecord) + header.string_bytes) {
+      warningQuda("Truncated binary tunecache %s", source);
+      return false;
+    }
+
+    const TuneCacheRecord *records = reinterpret_cast<const TuneCacheRecord *>(buffer + sizeof(TuneCacheHeader));
+    const char *strings = buffer + sizeof(TuneCacheHeader) + header.n_entry * sizeof(TuneCacheRecord);
+
+    auto valid = [&](const TuneCacheString &s, size_t max_length) {
+      return s.length < max_length && static_cast<uint64_t>(s.offset) + s.length < header.string_bytes
+        && strings[s.offset + s.length] == '\0';
+    };
+
+    if (!valid(header.version, 256) || !valid(header.git_version, 256) || !valid(header.build_hash, 256)) {
+      warningQuda("Corrupt binary tunecache %s", source);
+      return false;
+    }
+
+    if (version_check) {
+#ifdef GITVERSION
+      const char *git_version = gitversion;
+#else
+      const char *git_version = quda_version.c_str();
+#endif
+      if (quda_version.compare(strings + header.version.offset) || strcmp(git_version, strings + header.git_version.offset)
+          || quda_hash.compare(strings + header.build_hash.offset)) {
+        warningQuda("Binary tunecache %s does not match current QUDA build", source);
+        return false;
+      }
+    }
+
+    // validate every record before touching the tunecache so that a corrupt buffer leaves it unchanged
+    for (uint64_t i = 0; i < header.n_entry; i++) {
+      const TuneCacheRecord &record = records[i];
+      if (!valid(record.volume, TuneKey::volume_n) || !valid(record.name, TuneKey::name_n)
+          || !valid(record.aux, TuneKey::aux_n) || !valid(record.comment, header.string_bytes)) {
+        warningQuda("Corrupt binary tunecache %s", source);
+        return false;
+      }
+    }
+
+    TuneKey key;
+    TuneParam param;
+    for (uint64_t i = 0; i < header.n_entry; i++) {
+      TuneCacheRecord record;
+      memcpy(&record, &records[i], sizeof(TuneCacheRecord)); // the mapped buffer need not be suitably aligned
+
+      memcpy(key.volume, strings + record.volume.offset, record.volume.length + 1);
+      memcpy(key.name, strings + record.name.offset, record.name.length + 1);
+      memcpy(key.aux, strings + record.aux.offset, record.aux.length + 1);
+
+      param.block = dim3(record.block[0], record.block[1], record.block[2]);
+      param.grid = dim3(record.grid[0], record.grid[1], record.grid[2]);
+      param.shared_bytes = record.shared_bytes;
+      param.aux = make_int4(record.param_aux[0], record.param_aux[1], record.param_aux[2], record.param_aux[3]);
+      param.time = record.time;
+      param.comment.assign(strings + record.comment.offset, record.comment.length);
+
+      if (merge) {
+        if (mergeTuneParam(key, param, record.hash) && journal) appendTuneJournal(key, param, record.hash);
+      } else
+        insertTuneCache(key, param, record.hash);
+    }
+
+    return true;
+  }
+
+  /**
+   * Read a binary tunecache file through mmap()
+   * @return Whether the file was read successfully
+   */
+  static bool loadTuneCacheBinary(const std::string &path, bool version_check, bool merge)
+  {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) return false;
+
+    struct stat fstat_buf;
+    if (fstat(fd, &fstat_buf) || fstat_buf.st_size == 0) {
+      close(fd);
+      return false;
+    }
+
+    size_t bytes = fstat_buf.st_size;
+    void *buffer = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (buffer == MAP_FAILED) {
+      warningQuda("Unable to map %s", path.c_str());
+      return false;
+    }
+
+    bool success
+      = deserializeTuneCacheBinary(static_cast<const char *>(buffer), bytes, version_check, path.c_str(), merge);
+    munmap(buffer, bytes);
+    return success;
+  }
+
+  /**
+   * Write the binary tunecache to disk.  We write to a temporary file
+   * and rename it into place so that concurrent readers never map a
+   * partially written file.
+   */
+  static bool saveTuneCacheBinary(const std::string &path)
+  {
+    std::vector<char> buffer;
+    serializeTuneCacheBinary(buffer);
+
+    std::string tmp_path = path + ".tmp";
+    std::ofstream file(tmp_path.c_str(), std::ios::binary);
+    file.write(buffer.data(), buffer.size());
+    file.close();
+    if (!file || rename(tmp_path.c_str(), path.c_str())) {
+      warningQuda("Unable to write binary tunecache %s", path.c_str());
+      remove(tmp_path.c_str());
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * Read a text tunecache file, checking its header against the current build.
+   * @return Whether the file could be opened
+   */
+  static bool loadTuneCacheText(const std::string &cache_path, bool version_check, bool merge)
+  {
+    std::string line, token;
+    std::stringstream ls;
+    std::ifstream cache_file(cache_path.c_str());
+    if (!cache_file) return false;
+
+    if (!cache_file.good()) errorQuda("Bad format in %s", cache_path.c_str());
+    getline(cache_file, line);
+    ls.str(line);
+    ls >> token;
+    if (token.compare("tunecache")) errorQuda("Bad format in %s", cache_path.c_str());
+    ls >> token;
+    if (version_check && token.compare(quda_version))
+      errorQuda("Cache file %s does not match current QUDA version. \nPlease delete this file or set the "
+                "QUDA_RESOURCE_PATH environment variable to point to a new path.",
+                cache_path.c_str());
+    ls >> token;
+#ifdef GITVERSION
+    if (version_check && token.compare(gitversion))
+      errorQuda("Cache file %s does not match current QUDA version. \nPlease delete this file or set the "
+                "QUDA_RESOURCE_PATH environment variable to point to a new path.",
+                cache_path.c_str());
+#else
+    if (version_check && token.compare(quda_version))
+      errorQuda("Cache file %s does not match current QUDA version. \nPlease delete this file or set the "
+                "QUDA_RESOURCE_PATH environment variable to point to a new path.",
+                cache_path.c_str());
+#endif
+    ls >> token;
+    if (version_check && token.compare(quda_hash))
+      errorQuda("Cache file %s does not match current QUDA build. \nPlease delete this file or set the "
+                "QUDA_RESOURCE_PATH environment variable to point to a new path.",
+                cache_path.c_str());
+
+    if (!cache_file.good()) errorQuda("Bad format in %s", cache_path.c_str());
+    getline(cache_file, line); // eat the blank line
+
+    if (!cache_file.good()) errorQuda("Bad format in %s", cache_path.c_str());
+    getline(cache_file, line); // eat the description line
+
+    deserializeTuneCache(cache_file, merge);
+
+    cache_file.close();
+    return true;
+  }
+
+  /**
+   * Read the tunecache stored in a resource directory, preferring
+   * tunecache.bin unless tunecache.tsv has been modified since it was
+   * written.
+   * @return Path of the file that was read, or an empty string if none was found
+   */
+  static std::string loadTuneCacheDir(const std::string &dir, bool version_check, bool merge)
+  {
+    std::string cache_path = dir + "/tunecache.tsv";
+    std::string binary_path = dir + "/tunecache.bin";
+
+    struct stat tsv_stat, bin_stat;
+    bool have_tsv = stat(cache_path.c_str(), &tsv_stat) == 0;
+    bool have_bin = stat(binary_path.c_str(), &bin_stat) == 0;
+    if (have_bin && (!have_tsv || bin_stat.st_mtime >= tsv_stat.st_mtime)) {
+      if (loadTuneCacheBinary(binary_path, version_check, merge)) return binary_path;
+    } else if (have_bin) {
+      warningQuda("%s is newer than %s, loading the former", cache_path.c_str(), binary_path.c_str());
+    }
+
+    return loadTuneCacheText(cache_path, version_check, merge) ? cache_path : std::string();
+  }
+
+  /**
+   * Write the text tunecache to disk.
+   */
+  static void saveTuneCacheText(const std::string &cache_path)
+  {
+    time_t now;
+    std::ofstream cache_file(cache_path.c_str());
+
+    time(&now);
+    cache_file << "tunecache\t" << quda_version;
+#ifdef GITVERSION
+    cache_file << "\t" << gitversion;
+#else
+    cache_file << "\t" << quda_version;
+#endif
+    cache_file << "\t" << quda_hash << "\t# Last updated " << ctime(&now) << std::endl;
+    cache_file << std::setw(16) << "volume"
+               << "\tname\taux\tblock.x\tblock.y\tblock.z\tgrid.x\tgrid.y\tgrid.z\tshared_bytes\taux.x\taux.y\taux."
+                  "z\taux.w\ttime\tcomment"
+               << std::endl;
+    serializeTuneCache(cache_file);
+    cache_file.close();
+  }
+
+  static bool tuneVersionCheck()
+  {
+    char *override_version_env = getenv("QUDA_TUNE_VERSION_CHECK");
+    return !(override_version_env && strcmp(override_version_env, "0") == 0);
+  }
+
+  bool mergeTuneCache(const std::string &path)
+  {
+    struct stat pstat;
+    if (stat(path.c_str(), &pstat)) return false;
+    if (S_ISDIR(pstat.st_mode)) return !loadTuneCacheDir(path, tuneVersionCheck(), true).empty();
+
+    // identify binary caches by their magic number rather than by name
+    char magic[sizeof(tunecache_magic)] = {};
+    std::ifstream file(path.c_str(), std::ios::binary);
+    file.read(magic, sizeof(magic));
+    file.close();
+    if (memcmp(magic, tunecache_magic, sizeof(magic)) == 0) return loadTuneCacheBinary(path, tuneVersionCheck(), true);
+    return loadTuneCacheText(path, tuneVersionCheck(), true);
+  }
+
+  void writeTuneCache(const std::string &dir)
+  {
+    saveTuneCacheText(dir + "/tunecache.tsv");
+    if (!saveTuneCacheBinary(dir + "/tunecache.bin")) errorQuda("Failed to write %s/tunecache.bin", dir.c_str());
+  }
+
   template <class T> struct less_significant : std::binary_function<T, T, bool> {
     inline bool operator()(const T &lhs, const T &rhs)
     {
@@ -273,67 +1168,526 @@ namespace quda
   }
 
   /**
-   * Serialize trace to an ostream, useful for writing to a file or sending to other nodes.
+   * Distribute the tunecache from node 0 to all other nodes.
    */
-  static void serializeTrace(std::ostream &out)
+  static void broadcastTuneCache()
   {
-    for (auto it = trace_list.begin(); it != trace_list.end(); it++) {
+#ifdef MULTI_GPU
+    std::vector<char> serialized;
+    size_t size;
 
-      TuneKey &key = it->key;
+    if (comm_rank() == 0) {
+      serializeTuneCacheBinary(serialized);
+      size = serialized.size();
+    }
+    comm_broadcast(&size, sizeof(size_t));
 
-      // special case kernel members of a policy
-      char tmp[TuneKey::aux_n] = {};
-      strncpy(tmp, key.aux, TuneKey::aux_n);
-      bool is_policy_kernel = strcmp(tmp, "policy_kernel") == 0 ? true : false;
+    if (size > 0) {
+      if (comm_rank() != 0) serialized.resize(size);
+      comm_broadcast(serialized.data(), size);
+      if (comm_rank() != 0 && !deserializeTuneCacheBinary(serialized.data(), size, false, "broadcast", false))
+        errorQuda("Failed to deserialize broadcast tunecache");
+    }
+#endif
+  }
+
+
+  /*
+   * Tunecache journal: every new tuning result is appended to
+   * tunecache.journal as a fixed-size, self-checking record with a
+   * single write(), so that results survive a job being killed and
+   * concurrent jobs sharing QUDA_RESOURCE_PATH never lose or block on
+   * each other's results.  The journal is replayed when the cache is
+   * loaded and folded into tunecache.tsv/tunecache.bin (compacted)
+   * whenever the cache is written.
+   */
+  static constexpr uint32_t journal_magic = 0x524a5451; // "QTJR"
+  static constexpr uint32_t journal_format_version = 1;
+
+  struct TuneJournalRecord {
+    uint32_t magic;
+    uint32_t format_version;
+    uint64_t build_id;
+    uint64_t hash;
+    char volume[TuneKey::volume_n];
+    char name[TuneKey::name_n];
+    char aux[TuneKey::aux_n];
+    char comment[160];
+    int32_t block[3];
+    int32_t grid[3];
+    int32_t shared_bytes;
+    int32_t param_aux[4];
+    float time;
+    uint64_t checksum; // FNV-1a of all preceding bytes, used to reject torn or corrupt records
+  };
 
-      out << std::setw(12) << it->time << "\t";
-      out << std::setw(12) << it->device_bytes << "\t";
-      out << std::setw(12) << it->pinned_bytes << "\t";
-      out << std::setw(12) << it->mapped_bytes << "\t";
-      out << std::setw(12) << it->host_bytes << "\t";
-      out << std::setw(16) << key.volume << "\t";
-      if (is_policy_kernel) out << "\t";
-      out << key.name << "\t";
-      if (!is_policy_kernel) out << "\t";
-      out << key.aux << std::endl;
+  static uint64_t fnv1a(const char *data, size_t bytes, uint64_t hash = 14695981039346656037ull)
+  {
+    for (size_t i = 0; i < bytes; i++) {
+      hash ^= static_cast<unsigned char>(data[i]);
+      hash *= 1099511628211ull;
     }
+    return hash;
   }
 
   /**
-   * Distribute the tunecache from node 0 to all other nodes.
+     @brief Identifier of the current QUDA build, so that journal
+     records written by other builds can be rejected
+  */
+  static uint64_t tuneBuildId()
+  {
+#ifdef GITVERSION
+    std::string id = quda_version + "\t" + gitversion + "\t" + quda_hash;
+#else
+    std::string id = quda_version + "\t" + quda_version + "\t" + quda_hash;
+#endif
+    return fnv1a(id.c_str(), id.size());
+  }
+
+  static std::string journalPath() { return resource_path + "/tunecache.journal"; }
+
+  /**
+   * Append a new tuning result to the journal.  The journal is opened
+   * for each append; a shared flock() is held across the write so that
+   * compaction can wait for in-flight appends, and if the journal was
+   * retired by a compaction between our open() and flock() we retry on
+   * the fresh journal.
    */
-  static void broadcastTuneCache()
+  static void appendTuneJournal(const TuneKey &key, const TuneParam &param, uint64_t hash)
   {
-#ifdef MULTI_GPU
-    std::stringstream serialized;
-    size_t size;
+    if (resource_path.empty()) return;
 
-    if (comm_rank() == 0) {
-      serializeTuneCache(serialized);
-      size = serialized.str().length();
+    TuneJournalRecord record;
+    memset(&record, 0, sizeof(record));
+    record.magic = journal_magic;
+    record.format_version = journal_format_version;
+    record.build_id = tuneBuildId();
+    record.hash = hash;
+    strcpy(record.volume, key.volume);
+    strcpy(record.name, key.name);
+    strcpy(record.aux, key.aux);
+    if (param.comment.size() < sizeof(record.comment)) {
+      strcpy(record.comment, param.comment.c_str());
+    } else { // truncate, keeping our convention that the comment ends with a newline
+      memcpy(record.comment, param.comment.c_str(), sizeof(record.comment) - 2);
+      record.comment[sizeof(record.comment) - 2] = '\n';
     }
-    comm_broadcast(&size, sizeof(size_t));
+    record.block[0] = param.block.x;
+    record.block[1] = param.block.y;
+    record.block[2] = param.block.z;
+    record.grid[0] = param.grid.x;
+    record.grid[1] = param.grid.y;
+    record.grid[2] = param.grid.z;
+    record.shared_bytes = param.shared_bytes;
+    record.param_aux[0] = param.aux.x;
+    record.param_aux[1] = param.aux.y;
+    record.param_aux[2] = param.aux.z;
+    record.param_aux[3] = param.aux.w;
+    record.time = param.time;
+    record.checksum = fnv1a(reinterpret_cast<const char *>(&record), offsetof(TuneJournalRecord, checksum));
+
+    const std::string path = journalPath();
+    for (int attempt = 0; attempt < 8; attempt++) {
+      int fd = open(path.c_str(), O_WRONLY | O_APPEND | O_CREAT, 0666);
+      if (fd == -1) break;
+      flock(fd, LOCK_SH);
+
+      struct stat fd_stat, path_stat;
+      bool current = fstat(fd, &fd_stat) == 0 && stat(path.c_str(), &path_stat) == 0
+        && fd_stat.st_ino == path_stat.st_ino && fd_stat.st_dev == path_stat.st_dev;
+      ssize_t written = current ? write(fd, &record, sizeof(record)) : 0;
+
+      flock(fd, LOCK_UN);
+      close(fd);
+      if (current) {
+        if (written != sizeof(record)) warningQuda("Incomplete write to tunecache journal %s", path.c_str());
+        return;
+      }
+    }
+    warningQuda("Unable to append to tunecache journal %s", path.c_str());
+  }
 
-    if (size > 0) {
-      if (comm_rank() == 0) {
-        comm_broadcast(const_cast<char *>(serialized.str().c_str()), size);
-      } else {
-        char *serstr = new char[size + 1];
-        comm_broadcast(serstr, size);
-        serstr[size] = '\0'; // null-terminate
-        serialized.str(serstr);
-        deserializeTuneCache(serialized);
-        delete[] serstr;
+  /**
+   * Replay a journal into the tunecache, merging by best time.
+   * Trailing partial records (from an append in flight) and records
+   * that fail their checksum are skipped.
+   * @return The number of valid records replayed
+   */
+  static size_t replayTuneJournal(const std::string &path, bool version_check)
+  {
+    std::ifstream file(path.c_str(), std::ios::binary);
+    if (!file) return 0;
+
+    const uint64_t build_id = tuneBuildId();
+    size_t n_valid = 0, n_corrupt = 0, n_foreign = 0;
+    TuneJournalRecord record;
+    TuneKey key;
+    TuneParam param;
+
+    while (file.read(reinterpret_cast<char *>(&record), sizeof(record))) {
+      if (record.magic != journal_magic || record.format_version != journal_format_version
+          || record.checksum != fnv1a(reinterpret_cast<const char *>(&record), offsetof(TuneJournalRecord, checksum))
+          || !memchr(record.volume, '\0', sizeof(record.volume)) || !memchr(record.name, '\0', sizeof(record.name))
+          || !memchr(record.aux, '\0', sizeof(record.aux)) || !memchr(record.comment, '\0', sizeof(record.comment))) {
+        n_corrupt++;
+        continue;
+      }
+      if (version_check && record.build_id != build_id) {
+        n_foreign++;
+        continue;
+      }
+
+      strcpy(key.volume, record.volume);
+      strcpy(key.name, record.name);
+      strcpy(key.aux, record.aux);
+      param.block = dim3(record.block[0], record.block[1], record.block[2]);
+      param.grid = dim3(record.grid[0], record.grid[1], record.grid[2]);
+      param.shared_bytes = record.shared_bytes;
+      param.aux = make_int4(record.param_aux[0], record.param_aux[1], record.param_aux[2], record.param_aux[3]);
+      param.time = record.time;
+      param.comment = record.comment;
+
+      mergeTuneParam(key, param, record.hash);
+      n_valid++;
+    }
+
+    if (n_corrupt > 0) warningQuda("Skipped %lu corrupt records in tunecache journal %s", n_corrupt, path.c_str());
+    if (n_foreign > 0)
+      warningQuda("Skipped %lu records from a different QUDA build in tunecache journal %s", n_foreign, path.c_str());
+
+    return n_valid;
+  }
+
+  /**
+   * @return Journals retired by a compaction that did not complete,
+   * e.g., because the job was killed part way through
+   */
+  static std::vector<std::string> retiredJournals()
+  {
+    std::vector<std::string> journals;
+    DIR *dir = opendir(resource_path.c_str());
+    if (!dir) return journals;
+    const std::string prefix = "tunecache.journal.";
+    while (struct dirent *entry = readdir(dir)) {
+      if (strncmp(entry->d_name, prefix.c_str(), prefix.size()) == 0)
+        journals.push_back(resource_path + "/" + entry->d_name);
+    }
+    closedir(dir);
+    return journals;
+  }
+
+  /**
+   * Acquire the tunecache lock without blocking.  We use flock() rather
+   * than exclusive creation of the lock file, so that the lock is
+   * released by the kernel if the process dies and a killed job can
+   * never leave a stale lock behind.  Note that this is only robust if
+   * the filesystem supports flock() semantics, which is true for NFS on
+   * recent versions of linux but not Lustre by default (unless the
+   * filesystem was mounted with "-o flock").
+   * @return File descriptor holding the lock, or -1 if it is held elsewhere
+   */
+  static int lockTuneCache()
+  {
+    std::string lock_path = resource_path + "/tunecache.lock";
+    int fd = open(lock_path.c_str(), O_WRONLY | O_CREAT, 0666);
+    if (fd == -1) return -1;
+    if (flock(fd, LOCK_EX | LOCK_NB)) {
+      close(fd);
+      return -1;
+    }
+    return fd;
+  }
+
+  static void unlockTuneCache(int fd)
+  {
+    flock(fd, LOCK_UN);
+    close(fd);
+  }
+
+  /**
+   * Fold the journal into the tunecache and write the consolidated
+   * tunecache.tsv and tunecache.bin, retiring the journal.  The live
+   * journal is first renamed so that new appends start a fresh one,
+   * then we take an exclusive flock() on the retired journal to wait
+   * for any append that raced with the rename.  Must be called with
+   * the tunecache lock held.
+   */
+  static void compactTuneCache()
+  {
+    const bool version_check = tuneVersionCheck();
+    std::vector<std::string> retired = retiredJournals(); // left over from an interrupted compaction
+
+    // the pid alone is not unique when the resource path is shared between nodes
+    std::string retired_path = journalPath() + "." + comm_hostname() + "." + std::to_string(getpid());
+    int retired_fd = -1;
+    if (rename(journalPath().c_str(), retired_path.c_str()) == 0) {
+      retired_fd = open(retired_path.c_str(), O_RDONLY);
+      if (retired_fd != -1) flock(retired_fd, LOCK_EX);
+      retired.push_back(retired_path);
+    }
+
+    // pick up anything compacted by other jobs since we loaded the cache, so that we don't overwrite it
+    loadTuneCacheDir(resource_path, version_check, true);
+    for (auto &path : retired) replayTuneJournal(path, version_check);
+
+    saveTuneCacheText(resource_path + "/tunecache.tsv");
+    binary_cache_current = saveTuneCacheBinary(resource_path + "/tunecache.bin");
+
+    // only retire the journals once their contents are safely in the cache files
+    if (binary_cache_current)
+      for (auto &path : retired) remove(path.c_str());
+    if (retired_fd != -1) close(retired_fd);
+
+    initial_cache_size = tunecache.size();
+  }
+
+  /**
+   * Gather the entries tuned on other nodes onto node 0, merging them
+   * into its tunecache by best time.  This catches kernels that node 0
+   * never tuned itself, e.g., with uneven subvolumes or rank-specific
+   * boundary kernels.
+   */
+  static void gatherTuneCache()
+  {
+#ifdef MULTI_GPU
+    if (comm_size() == 1) return;
+
+    std::vector<char> local;
+    if (comm_rank() != 0 && local_entries.size() > 0) serializeTuneCacheBinary(local, local_entries);
+    local_entries.clear();
+
+    // cheap check first since this is called at every save
+    int any_local = local.size() > 0 ? 1 : 0;
+    comm_allreduce_int(&any_local);
+    if (any_local == 0) return;
+
+    std::vector<double> bytes(comm_size(), 0.0);
+    bytes[comm_rank()] = local.size();
+    comm_allreduce_array(bytes.data(), bytes.size());
+
+    std::vector<size_t> recv_bytes(comm_size());
+    size_t total_bytes = 0;
+    for (int i = 0; i < comm_size(); i++) {
+      recv_bytes[i] = static_cast<size_t>(bytes[i]);
+      total_bytes += recv_bytes[i];
+    }
+
+    std::vector<char> gathered(comm_rank() == 0 ? total_bytes : 0);
+    comm_gather_bytes(gathered.data(), recv_bytes.data(), local.data(), local.size());
+
+    if (comm_rank() == 0) {
+      size_t n_before = tunecache.size();
+      size_t offset = 0;
+      for (int i = 0; i < comm_size(); i++) {
+        if (recv_bytes[i] > 0) {
+          std::string source = "from rank " + std::to_string(i);
+          // journal the gathered entries too, so they are not lost if the cache cannot be written now
+          if (!deserializeTuneCacheBinary(gathered.data() + offset, recv_bytes[i], false, source.c_str(), true, true))
+            errorQuda("Failed to deserialize tunecache %s", source.c_str());
+        }
+        offset += recv_bytes[i];
       }
+      if (getVerbosity() >= QUDA_DEBUG_VERBOSE)
+        printfQuda("Gathered %lu new tunecache entries from other ranks\n", tunecache.size() - n_before);
     }
 #endif
   }
 
+  /*
+   * Roofline report (QUDA_ENABLE_ROOFLINE).  While the profile is being
+   * counted, we also accumulate the flops and bytes reported by the
+   * Tunable for each launch, so that saveProfile can report the
+   * achieved GFLOP/s, GB/s and arithmetic intensity of each kernel.
+   * Kernels whose achieved bandwidth is below a fraction
+   * (QUDA_ROOFLINE_THRESHOLD, default 0.5) of the bandwidth ceiling are
+   * flagged.  The ceiling for device kernels is the theoretical peak of
+   * the device, and that for host kernels (those with ",CPU" in their
+   * aux string) is measured at initialization with a STREAM-like triad;
+   * either can be overridden with QUDA_ROOFLINE_DEVICE_BANDWIDTH or
+   * QUDA_ROOFLINE_HOST_BANDWIDTH (in GB/s).
+   */
+  static double host_bandwidth = 0.0;
+
+  static bool rooflineEnabled()
+  {
+    static bool init = false;
+    static bool enable = false;
+    if (!init) {
+      char *enable_roofline_env = getenv("QUDA_ENABLE_ROOFLINE");
+      enable = enable_roofline_env && strcmp(enable_roofline_env, "0") != 0;
+      init = true;
+    }
+    return enable;
+  }
+
+  static double rooflineEnv(const char *name, double default_value)
+  {
+    char *env = getenv(name);
+    if (!env) return default_value;
+    double value = atof(env);
+    if (value <= 0.0) errorQuda("Invalid %s=%s", name, env);
+    return value;
+  }
+
+  /**
+   * Measure the host memory bandwidth available to this process with
+   * a STREAM triad.  This is run by all processes concurrently, so
+   * that the result reflects the bandwidth available to each process
+   * when the node is fully subscribed.
+   * @return Bandwidth in GB/s
+   */
+  static double measureHostBandwidth()
+  {
+    const size_t n = static_cast<size_t>(rooflineEnv("QUDA_ROOFLINE_STREAM_BYTES", 256 << 20)) / (3 * sizeof(double));
+    double *a = static_cast<double *>(safe_malloc(n * sizeof(double)));
+    double *b = static_cast<double *>(safe_malloc(n * sizeof(double)));
+    double *c = static_cast<double *>(safe_malloc(n * sizeof(double)));
+
+#pragma omp parallel for
+    for (size_t i = 0; i < n; i++) {
+      a[i] = 0.0;
+      b[i] = 1.0;
+      c[i] = 2.0;
+    }
+
+    double best = DBL_MAX;
+    for (int rep = 0; rep < 5; rep++) {
+      Timer timer;
+      timer.Start(__func__, __FILE__, __LINE__);
+#pragma omp parallel for
+      for (size_t i = 0; i < n; i++) a[i] = b[i] + 3.0 * c[i];
+      timer.Stop(__func__, __FILE__, __LINE__);
+      best = std::min(best, timer.Last());
+    }
+
+    host_free(c);
+    host_free(b);
+    host_free(a);
+
+    return 3 * n * sizeof(double) / (1e9 * best);
+  }
+
+  static double deviceBandwidth()
+  {
+    // memoryClockRate is in kHz, memoryBusWidth is in bits, and the memory is double data rate
+    double peak = 2.0 * deviceProp.memoryClockRate * 1e3 * (deviceProp.memoryBusWidth / 8) / 1e9;
+    return rooflineEnv("QUDA_ROOFLINE_DEVICE_BANDWIDTH", peak);
+  }
+
+  static void initRoofline()
+  {
+    if (!rooflineEnabled()) return;
+    char *host_bandwidth_env = getenv("QUDA_ROOFLINE_HOST_BANDWIDTH");
+    host_bandwidth = host_bandwidth_env ? rooflineEnv("QUDA_ROOFLINE_HOST_BANDWIDTH", 0.0) : measureHostBandwidth();
+    if (getVerbosity() >= QUDA_SUMMARIZE)
+      printfQuda("Roofline bandwidth ceilings: device %.1f GB/s, host %.1f GB/s%s\n", deviceBandwidth(), host_bandwidth,
+                 host_bandwidth_env ? "" : " (measured)");
+  }
+
+  static void rooflineCount(const map::value_type *entry, long long flops, long long bytes)
+  {
+    RooflineCount &count = roofline_counts[entry];
+    count.flops += flops;
+    count.bytes += bytes;
+  }
+
+  struct RooflineEntry {
+    const TuneKey *key;
+    const TuneParam *param;
+    double gflops; // achieved GFLOP/s
+    double gbytes; // achieved GB/s
+    double intensity; // flops per byte
+    bool host;
+    double ceiling; // bandwidth ceiling in GB/s
+    bool flagged;
+  };
+
+  static std::string csvQuote(const char *str)
+  {
+    std::string quoted = "\"";
+    for (const char *c = str; *c; c++) quoted += (*c == '"') ? std::string("\"\"") : std::string(1, *c);
+    return quoted + "\"";
+  }
+
+  /**
+   * Write the roofline report as CSV and JSON, sorted in decreasing
+   * order of total time spent in each kernel.
+   * @return The number of flagged kernels
+   */
+  static int serializeRoofline(std::ostream &csv, std::ostream &json, const std::string &label)
+  {
+    const double threshold = rooflineEnv("QUDA_ROOFLINE_THRESHOLD", 0.5);
+    const double device_ceiling = deviceBandwidth();
+
+    std::vector<RooflineEntry> entries;
+    for (auto &entry : tunecache) {
+      const TuneKey &key = entry.first;
+      const TuneParam &param = entry.second;
+      bool is_policy_kernel = strncmp(key.aux, "policy_kernel", 13) == 0;
+      bool is_policy = strncmp(key.aux, "policy", 6) == 0 && !is_policy_kernel;
+      bool is_nested_policy = strncmp(key.aux, "nested_policy", 13) == 0;
+      auto count = roofline_counts.find(&entry);
+      if (param.n_calls == 0 || is_policy || is_nested_policy || count == roofline_counts.end()) continue;
+
+      RooflineEntry r;
+      r.key = &key;
+      r.param = &param;
+      double flops = count->second.flops / param.n_calls;
+      double bytes = count->second.bytes / param.n_calls;
+      r.gflops = flops / (1e9 * param.time);
+      r.gbytes = bytes / (1e9 * param.time);
+      r.intensity = bytes > 0 ? flops / bytes : 0.0;
+      r.host = strstr(key.aux, ",CPU") != nullptr;
+      r.ceiling = r.host ? host_bandwidth : device_ceiling;
+      // kernels that do not report their bytes cannot be placed on the roofline
+      r.flagged = bytes > 0 && r.gbytes < threshold * r.ceiling;
+      entries.push_back(r);
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const RooflineEntry &a, const RooflineEntry &b) {
+      return a.param->n_calls * a.param->time > b.param->n_calls * b.param->time;
+    });
+
+    csv << "volume,name,aux,location,calls,time_per_call,total_time,gflops,gbytes,intensity,ceiling_gbytes,"
+           "fraction_of_ceiling,flagged"
+        << std::endl;
+
+    json << "{" << timeline::arg("label", label) << "," << timeline::arg("version", quda_version) << ","
+         << timeline::arg("hash", quda_hash) << ",\"device_bandwidth\":" << device_ceiling
+         << ",\"host_bandwidth\":" << host_bandwidth << ",\"threshold\":" << threshold << ",\"kernels\":[";
+
+    int n_flagged = 0;
+    for (size_t i = 0; i < entries.size(); i++) {
+      const RooflineEntry &r = entries[i];
+      double total_time = r.param->n_calls * r.param->time;
+      double fraction = r.ceiling > 0 ? r.gbytes / r.ceiling : 0.0;
+      if (r.flagged) n_flagged++;
+
+      csv << csvQuote(r.key->volume) << "," << csvQuote(r.key->name) << "," << csvQuote(r.key->aux) << ","
+          << (r.host ? "host" : "device") << "," << r.param->n_calls << "," << r.param->time << "," << total_time << ","
+          << r.gflops << "," << r.gbytes << "," << r.intensity << "," << r.ceiling << "," << fraction << ","
+          << (r.flagged ? 1 : 0) << std::endl;
+
+      json << (i > 0 ? "," : "") << "\n{" << timeline::arg("volume", r.key->volume) << ","
+           << timeline::arg("name", r.key->name) << "," << timeline::arg("aux", r.key->aux) << ","
+           << timeline::arg("location", r.host ? "host" : "device") << ",\"calls\":" << r.param->n_calls
+           << ",\"time_per_call\":" << r.param->time << ",\"total_time\":" << total_time << ",\"gflops\":" << r.gflops
+           << ",\"gbytes\":" << r.gbytes << ",\"intensity\":" << r.intensity << ",\"ceiling_gbytes\":" << r.ceiling
+           << ",\"fraction_of_ceiling\":" << fraction << ",\"flagged\":" << (r.flagged ? "true" : "false") << "}";
+    }
+    json << "\n]}" << std::endl;
+
+    return n_flagged;
+  }
+
   /*
    * Read tunecache from disk.
    */
   void loadTuneCache()
   {
+    // the roofline ceilings do not depend on the tunecache, so set them even if it is not loaded
+    initRoofline();
+
     if (getTuning() == QUDA_TUNE_NO) {
       warningQuda("Autotuning disabled");
       return;
@@ -341,9 +1695,6 @@ namespace quda
 
     char *path;
     struct stat pstat;
-    std::string cache_path, line, token;
-    std::ifstream cache_file;
-    std::stringstream ls;
 
     path = getenv("QUDA_RESOURCE_PATH");
 
@@ -359,71 +1710,46 @@ namespace quda
       resource_path = path;
     }
 
-    bool version_check = true;
-    char *override_version_env = getenv("QUDA_TUNE_VERSION_CHECK");
-    if (override_version_env && strcmp(override_version_env, "0") == 0) {
-      version_check = false;
-      warningQuda("Disabling QUDA tunecache version check");
-    }
+    bool version_check = tuneVersionCheck();
+    if (!version_check) warningQuda("Disabling QUDA tunecache version check");
 
 #ifdef MULTI_GPU
     if (comm_rank() == 0) {
 #endif
 
-      cache_path = resource_path;
-      cache_path += "/tunecache.tsv";
-      cache_file.open(cache_path.c_str());
-
-      if (cache_file) {
-
-        if (!cache_file.good()) errorQuda("Bad format in %s", cache_path.c_str());
-        getline(cache_file, line);
-        ls.str(line);
-        ls >> token;
-        if (token.compare("tunecache")) errorQuda("Bad format in %s", cache_path.c_str());
-        ls >> token;
-        if (version_check && token.compare(quda_version))
-          errorQuda("Cache file %s does not match current QUDA version. \nPlease delete this file or set the "
-                    "QUDA_RESOURCE_PATH environment variable to point to a new path.",
-                    cache_path.c_str());
-        ls >> token;
-#ifdef GITVERSION
-        if (version_check && token.compare(gitversion))
-          errorQuda("Cache file %s does not match current QUDA version. \nPlease delete this file or set the "
-                    "QUDA_RESOURCE_PATH environment variable to point to a new path.",
-                    cache_path.c_str());
-#else
-      if (version_check && token.compare(quda_version))
-        errorQuda("Cache file %s does not match current QUDA version. \nPlease delete this file or set the "
-                  "QUDA_RESOURCE_PATH environment variable to point to a new path.",
-                  cache_path.c_str());
-#endif
-        ls >> token;
-        if (version_check && token.compare(quda_hash))
-          errorQuda("Cache file %s does not match current QUDA build. \nPlease delete this file or set the "
-                    "QUDA_RESOURCE_PATH environment variable to point to a new path.",
-                    cache_path.c_str());
-
-        if (!cache_file.good()) errorQuda("Bad format in %s", cache_path.c_str());
-        getline(cache_file, line); // eat the blank line
-
-        if (!cache_file.good()) errorQuda("Bad format in %s", cache_path.c_str());
-        getline(cache_file, line); // eat the description line
+      std::string cache_path = loadTuneCacheDir(resource_path, version_check, false);
 
-        deserializeTuneCache(cache_file);
-
-        cache_file.close();
+      if (!cache_path.empty()) {
         initial_cache_size = tunecache.size();
+        binary_cache_current = cache_path.compare(cache_path.size() - 4, 4, ".bin") == 0;
 
         if (getVerbosity() >= QUDA_SUMMARIZE) {
           printfQuda("Loaded %d sets of cached parameters from %s\n", static_cast<int>(initial_cache_size),
                      cache_path.c_str());
         }
 
+      } else if (!stat(journalPath().c_str(), &pstat)) {
+        initial_cache_size = 0;
       } else {
         warningQuda("Cache file not found.  All kernels will be re-tuned (if tuning is enabled).");
       }
 
+      // replay results journaled by this or other jobs since the cache files were last written
+      size_t n_journal = replayTuneJournal(journalPath(), version_check);
+      for (auto &path : retiredJournals()) n_journal += replayTuneJournal(path, version_check);
+
+      if (n_journal > 0) {
+        if (getVerbosity() >= QUDA_SUMMARIZE)
+          printfQuda("Replayed %lu journaled sets of parameters from %s\n", n_journal, journalPath().c_str());
+
+        // compact if no other job is currently writing the cache, else leave it to them
+        int lock_handle = lockTuneCache();
+        if (lock_handle != -1) {
+          compactTuneCache();
+          unlockTuneCache(lock_handle);
+        }
+      }
+
 #ifdef MULTI_GPU
     }
 #endif
@@ -436,66 +1762,42 @@ namespace quda
    */
   void saveTuneCache(bool error)
   {
-    time_t now;
     int lock_handle;
-    std::string lock_path, cache_path;
-    std::ofstream cache_file;
+    std::string cache_path;
 
     if (resource_path.empty()) return;
 
-      // FIXME: We should really check to see if any nodes have tuned a kernel that was not also tuned on node 0, since as things
-      //       stand, the corresponding launch parameters would never get cached to disk in this situation.  This will come up if we
-      //       ever support different subvolumes per GPU (as might be convenient for lattice volumes that don't divide evenly).
+    // collect kernels tuned only on other nodes so that they are persisted too (collective, so not done on error,
+    // which need not be raised on all nodes)
+    if (!error) gatherTuneCache();
 
 #ifdef MULTI_GPU
     if (comm_rank() == 0) {
 #endif
 
-      if (tunecache.size() == initial_cache_size && !error) return;
+      // nothing to do unless new entries have been tuned or the binary cache needs to be (re)generated
+      if (tunecache.size() == initial_cache_size && !error && (binary_cache_current || tunecache.empty())) return;
 
-      // Acquire lock.  Note that this is only robust if the filesystem supports flock() semantics, which is true for
-      // NFS on recent versions of linux but not Lustre by default (unless the filesystem was mounted with "-o flock").
-      lock_path = resource_path + "/tunecache.lock";
-      lock_handle = open(lock_path.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0666);
+      lock_handle = lockTuneCache();
       if (lock_handle == -1) {
-        warningQuda("Unable to lock cache file.  Tuned launch parameters will not be cached to disk.  "
-                    "If you are certain that no other instances of QUDA are accessing this filesystem, "
-                    "please manually remove %s",
-                    lock_path.c_str());
+        // another job is writing the cache; our results are already in the journal, which it or a later job will fold in
+        warningQuda("Tunecache is locked by another job.  Tuned launch parameters remain in %s.", journalPath().c_str());
         return;
       }
-      char msg[] = "If no instances of applications using QUDA are running,\n"
-                   "this lock file shouldn't be here and is safe to delete.";
-      int stat = write(lock_handle, msg, sizeof(msg)); // check status to avoid compiler warning
-      if (stat == -1) warningQuda("Unable to write to lock file for some bizarre reason");
 
       cache_path = resource_path + (error ? "/tunecache_error.tsv" : "/tunecache.tsv");
-      cache_file.open(cache_path.c_str());
 
       if (getVerbosity() >= QUDA_SUMMARIZE) {
         printfQuda("Saving %d sets of cached parameters to %s\n", static_cast<int>(tunecache.size()), cache_path.c_str());
       }
 
-      time(&now);
-      cache_file << "tunecache\t" << quda_version;
-#ifdef GITVERSION
-      cache_file << "\t" << gitversion;
-#else
-    cache_file << "\t" << quda_version;
-#endif
-      cache_file << "\t" << quda_hash << "\t# Last updated " << ctime(&now) << std::endl;
-      cache_file << std::setw(16) << "volume"
-                 << "\tname\taux\tblock.x\tblock.y\tblock.z\tgrid.x\tgrid.y\tgrid.z\tshared_bytes\taux.x\taux.y\taux."
-                    "z\taux.w\ttime\tcomment"
-                 << std::endl;
-      serializeTuneCache(cache_file);
-      cache_file.close();
-
-      // Release lock.
-      close(lock_handle);
-      remove(lock_path.c_str());
+      if (error) {
+        saveTuneCacheText(cache_path);
+      } else {
+        compactTuneCache();
+      }
 
-      initial_cache_size = tunecache.size();
+      unlockTuneCache(lock_handle);
 
 #ifdef MULTI_GPU
     } else {
@@ -519,6 +1821,7 @@ namespace quda
       TuneParam &param = entry->second;
       param.n_calls = 0;
     }
+    roofline_counts.clear();
   }
 
   // save profile
@@ -526,8 +1829,8 @@ namespace quda
   {
     time_t now;
     int lock_handle;
-    std::string lock_path, profile_path, async_profile_path, trace_path;
-    std::ofstream profile_file, async_profile_file, trace_file;
+    std::string lock_path, profile_path, async_profile_path, roofline_path;
+    std::ofstream profile_file, async_profile_file;
 
     if (resource_path.empty()) return;
 
@@ -561,19 +1864,17 @@ namespace quda
           "Environment variable QUDA_PROFILE_OUTPUT_BASE not set; writing to profile.tsv and profile_async.tsv");
         profile_path = resource_path + "/profile_" + std::to_string(count) + ".tsv";
         async_profile_path = resource_path + "/profile_async_" + std::to_string(count) + ".tsv";
-        if (traceEnabled()) trace_path = resource_path + "/trace_" + std::to_string(count) + ".tsv";
+        roofline_path = resource_path + "/roofline_" + std::to_string(count);
       } else {
         profile_path = resource_path + "/" + profile_fname + "_" + std::to_string(count) + ".tsv";
         async_profile_path = resource_path + "/" + profile_fname + "_" + std::to_string(count) + "_async.tsv";
-        if (traceEnabled())
-          trace_path = resource_path + "/" + profile_fname + "_trace_" + std::to_string(count) + ".tsv";
+        roofline_path = resource_path + "/" + profile_fname + "_" + std::to_string(count) + "_roofline";
       }
 
       count++;
 
       profile_file.open(profile_path.c_str());
       async_profile_file.open(async_profile_path.c_str());
-      if (traceEnabled()) trace_file.open(trace_path.c_str());
 
       if (getVerbosity() >= QUDA_SUMMARIZE) {
         // compute number of non-zero entries that will be output in the profile
@@ -591,8 +1892,7 @@ namespace quda
 
         printfQuda("Saving %d sets of cached parameters to %s\n", n_entry, profile_path.c_str());
         printfQuda("Saving %d sets of cached profiles to %s\n", n_policy, async_profile_path.c_str());
-        if (traceEnabled())
-          printfQuda("Saving trace list with %lu entries to %s\n", trace_list.size(), trace_path.c_str());
+        if (trace_stream.active()) printfQuda("Kernel trace is being streamed to %s\n", trace_stream.filename().c_str());
       }
 
       time(&now);
@@ -632,26 +1932,21 @@ namespace quda
       profile_file.close();
       async_profile_file.close();
 
-      if (traceEnabled()) {
-        trace_file << "trace"
-                   << "\t" << quda_version;
-#ifdef GITVERSION
-        trace_file << "\t" << gitversion;
-#else
-      trace_file << "\t" << quda_version;
-#endif
-        trace_file << "\t" << quda_hash << "\t# Last updated " << ctime(&now) << std::endl;
-
-        trace_file << std::setw(12) << "time\t" << std::setw(12) << "device-mem\t" << std::setw(12) << "pinned-mem\t";
-        trace_file << std::setw(12) << "mapped-mem\t" << std::setw(12) << "host-mem\t";
-        trace_file << std::setw(16) << "volume"
-                   << "\tname\taux" << std::endl;
-
-        serializeTrace(trace_file);
-
-        trace_file.close();
+      if (rooflineEnabled()) {
+        std::ofstream roofline_csv((roofline_path + ".csv").c_str());
+        std::ofstream roofline_json((roofline_path + ".json").c_str());
+        int n_flagged = serializeRoofline(roofline_csv, roofline_json, Label);
+        if (getVerbosity() >= QUDA_SUMMARIZE) {
+          printfQuda("Saving roofline report to %s.csv and %s.json\n", roofline_path.c_str(), roofline_path.c_str());
+          if (n_flagged > 0)
+            printfQuda("%d kernels achieve less than %g of their bandwidth ceiling\n", n_flagged,
+                       rooflineEnv("QUDA_ROOFLINE_THRESHOLD", 0.5));
+        }
       }
 
+      // the trace is streamed to disk as it is recorded, so we need only ensure it is up to date
+      trace_stream.flush();
+
       // Release lock.
       close(lock_handle);
       remove(lock_path.c_str());
@@ -663,6 +1958,21 @@ namespace quda
 
   static TimeProfile launchTimer("tuneLaunch");
 
+  /**
+   * Record the launch of a tuned kernel on the timeline.  Launches are
+   * asynchronous, so these are instantaneous host-side events, with
+   * the tuned kernel time attached.
+   */
+  static void timelineLaunch(const TuneKey &key, const TuneParam &param)
+  {
+    char launch[128];
+    snprintf(launch, sizeof(launch), "block=(%u,%u,%u),grid=(%u,%u,%u),shared_bytes=%d", param.block.x, param.block.y,
+             param.block.z, param.grid.x, param.grid.y, param.grid.z, param.shared_bytes);
+    timeline::instant("kernel", key.name,
+                      timeline::arg("volume", key.volume) + "," + timeline::arg("aux", key.aux) + ","
+                        + timeline::arg("launch", launch) + "," + timeline::arg("tuned_time", std::to_string(param.time)));
+  }
+
   /**
    * Return the optimal launch parameters for a given kernel, either
    * by retrieving them from tunecache or autotuning on the spot.
@@ -686,17 +1996,18 @@ namespace quda
 #endif
 
     static const Tunable *active_tunable; // for error checking
-    it = tunecache.find(key);
+    const uint64_t hash = tuneKeyHash(key);
+    map::value_type *entry = tunecache_index.find(key, hash);
 
     // first check if we have the tuned value and return if we have it
-    if (enabled == QUDA_TUNE_YES && it != tunecache.end()) {
+    if (enabled == QUDA_TUNE_YES && entry) {
 
 #ifdef LAUNCH_TIMER
       launchTimer.TPSTOP(QUDA_PROFILE_PREAMBLE);
       launchTimer.TPSTART(QUDA_PROFILE_COMPUTE);
 #endif
 
-      TuneParam &param = it->second;
+      TuneParam &param = entry->second;
 
       if (verbosity >= QUDA_DEBUG_VERBOSE) {
         printfQuda("Launching %s with %s at vol=%s with %s\n", key.name, key.aux, key.volume,
@@ -711,17 +2022,18 @@ namespace quda
       tunable.checkLaunchParam(param);
 
       // we could be tuning outside of the current scope
-      if (!tuning && profile_count) param.n_calls++;
+      if (!tuning && profile_count) {
+        param.n_calls++;
+        if (rooflineEnabled()) rooflineCount(entry, tunable.flops(), tunable.bytes());
+      }
+      if (!tuning && timeline::enabled()) timelineLaunch(key, param);
 
 #ifdef LAUNCH_TIMER
       launchTimer.TPSTOP(QUDA_PROFILE_EPILOGUE);
       launchTimer.TPSTOP(QUDA_PROFILE_TOTAL);
 #endif
 
-      if (traceEnabled() >= 2) {
-        TraceKey trace_entry(key, param.time);
-        trace_list.push_back(trace_entry);
-      }
+      if (traceEnabled() >= 2) traceLaunch(key, hash, param.time);
 
       return param;
     }
@@ -821,6 +2133,9 @@ namespace quda
         }
 
         tune_timer.Stop(__func__, __FILE__, __LINE__);
+        if (timeline::enabled())
+          timeline::record("tune", key.name, tune_timer.start, tune_timer.stop,
+                           timeline::arg("volume", key.volume) + "," + timeline::arg("aux", key.aux));
 
         if (best_time == FLT_MAX) {
           errorQuda("Auto-tuning failed for %s with %s at vol=%s", key.name, key.aux, key.volume);
@@ -841,20 +2156,22 @@ namespace quda
         if (verbosity >= QUDA_DEBUG_VERBOSE) printfQuda("PostTune %s\n", key.name);
         tunable.postTune();
         param = best_param;
-        tunecache[key] = best_param;
+        insertTuneCache(key, best_param, hash);
+        if (comm_rank() == 0)
+          appendTuneJournal(key, best_param, hash);
+        else if (!commGlobalReduction() && !policyTuning())
+          // only rank-local tuning needs gathering, else process 0's result is broadcast below
+          local_entries.push_back(tunecache_index.find(key, hash));
       }
       if (commGlobalReduction() || policyTuning()) broadcastTuneCache();
 
       // check this process is getting the key that is expected
-      if (tunecache.find(key) == tunecache.end()) {
-        errorQuda("Failed to find key entry (%s:%s:%s)", key.name, key.volume, key.aux);
-      }
-      param = tunecache[key]; // read this now for all processes
+      entry = tunecache_index.find(key, hash);
+      if (!entry) errorQuda("Failed to find key entry (%s:%s:%s)", key.name, key.volume, key.aux);
+      param = entry->second; // read this now for all processes
+      if (timeline::enabled()) timelineLaunch(key, param);
 
-      if (traceEnabled() >= 2) {
-        TraceKey trace_entry(key, param.time);
-        trace_list.push_back(trace_entry);
-      }
+      if (traceEnabled() >= 2) traceLaunch(key, hash, param.time);
 
     } else if (&tunable != active_tunable) {
       errorQuda("Unexpected call to tuneLaunch() in %s::apply()", typeid(tunable).name());
@@ -0,0 +1,185 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <quda_internal.h>
+#include <timeline.h>
+
+namespace quda
+{
+
+  namespace timeline
+  {
+
+    struct Event {
+      const char *cat;
+      std::string name;
+      std::string args;
+      clock::time_point begin;
+      clock::time_point end;
+      bool instant;
+    };
+
+    /**
+       Each thread records into its own buffer, so recording needs no
+       synchronization once a thread's buffer has been registered.  The
+       buffers are owned by the registry, rather than the threads, so
+       that events recorded by short-lived (e.g., OpenMP) threads
+       survive until the timeline is saved.
+    */
+    struct ThreadBuffer {
+      int tid;
+      size_t dropped = 0;
+      std::vector<Event> events;
+      ThreadBuffer(int tid) : tid(tid) { }
+    };
+
+    static std::mutex registry_mutex;
+    static std::vector<std::unique_ptr<ThreadBuffer>> registry;
+    static thread_local ThreadBuffer *thread_buffer = nullptr;
+
+    // all timestamps are exported relative to this
+    static const clock::time_point origin = clock::now();
+
+    static size_t maxEvents()
+    {
+      static size_t max_events = 0;
+      if (max_events == 0) {
+        char *max_events_env = getenv("QUDA_TIMELINE_MAX_EVENTS");
+        max_events = max_events_env ? strtoul(max_events_env, nullptr, 10) : (1 << 20);
+        if (max_events == 0) errorQuda("Invalid QUDA_TIMELINE_MAX_EVENTS=%s", max_events_env);
+      }
+      return max_events;
+    }
+
+    bool enabled()
+    {
+      static const bool enable = [] {
+        char *enable_env = getenv("QUDA_ENABLE_TIMELINE");
+        return enable_env && strcmp(enable_env, "0") != 0;
+      }();
+      return enable;
+    }
+
+    static ThreadBuffer &threadBuffer()
+    {
+      if (!thread_buffer) {
+        std::lock_guard<std::mutex> lock(registry_mutex);
+        registry.emplace_back(new ThreadBuffer(registry.size()));
+        thread_buffer = registry.back().get();
+        thread_buffer->events.reserve(1024);
+      }
+      return *thread_buffer;
+    }
+
+    static void push(Event &&event)
+    {
+      ThreadBuffer &buffer = threadBuffer();
+      if (buffer.events.size() < maxEvents())
+        buffer.events.push_back(std::move(event));
+      else
+        buffer.dropped++;
+    }
+
+    void record(const char *cat, const std::string &name, clock::time_point begin, clock::time_point end,
+                const std::string &args)
+    {
+      if (!enabled()) return;
+      push(Event {cat, name, args, begin, end, false});
+    }
+
+    void instant(const char *cat, const std::string &name, const std::string &args)
+    {
+      if (!enabled()) return;
+      auto now = clock::now();
+      push(Event {cat, name, args, now, now, true});
+    }
+
+    static std::string escape(const std::string &str)
+    {
+      std::string escaped;
+      escaped.reserve(str.size());
+      for (char c : str) {
+        switch (c) {
+        case '"': escaped += "\\\""; break;
+        case '\\': escaped += "\\\\"; break;
+        case '\n': escaped += "\\n"; break;
+        case '\t': escaped += "\\t"; break;
+        default:
+          if (static_cast<unsigned char>(c) >= 0x20) escaped += c;
+        }
+      }
+      return escaped;
+    }
+
+    std::string arg(const char *key, const std::string &value)
+    {
+      return std::string("\"") + key + "\":\"" + escape(value) + "\"";
+    }
+
+    std::string arg(const char *key, long value) { return std::string("\"") + key + "\":" + std::to_string(value); }
+
+    // microseconds since the origin, as expected by the trace event format
+    static double timestamp(clock::time_point t) { return std::chrono::duration<double, std::micro>(t - origin).count(); }
+
+    void save(int rank)
+    {
+      if (!enabled()) return;
+
+      std::lock_guard<std::mutex> lock(registry_mutex);
+
+      char *path_env = getenv("QUDA_RESOURCE_PATH");
+      std::string path = std::string(path_env && strlen(path_env) > 0 ? path_env : ".") + "/timeline_"
+        + std::to_string(rank) + ".json";
+
+      std::ofstream file(path.c_str());
+      if (!file) {
+        warningQuda("Unable to open %s for writing the timeline", path.c_str());
+        return;
+      }
+      file.precision(3);
+      file << std::fixed;
+
+      size_t n_event = 0, n_dropped = 0;
+      file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+      file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank << ",\"tid\":0,\"args\":{\"name\":\"rank " << rank
+           << "\"}}";
+
+      for (auto &buffer : registry) {
+        file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << rank << ",\"tid\":" << buffer->tid
+             << ",\"args\":{\"name\":\"" << (buffer->tid == 0 ? "main" : "thread " + std::to_string(buffer->tid))
+             << "\"}}";
+
+        for (auto &event : buffer->events) {
+          file << ",\n{\"name\":\"" << escape(event.name) << "\",\"cat\":\"" << event.cat << "\"";
+          if (event.instant)
+            file << ",\"ph\":\"i\",\"s\":\"t\"";
+          else
+            file << ",\"ph\":\"X\",\"dur\":" << timestamp(event.end) - timestamp(event.begin);
+          file << ",\"ts\":" << timestamp(event.begin) << ",\"pid\":" << rank << ",\"tid\":" << buffer->tid;
+          if (!event.args.empty()) file << ",\"args\":{" << event.args << "}";
+          file << "}";
+        }
+
+        n_event += buffer->events.size();
+        n_dropped += buffer->dropped;
+        buffer->events.clear();
+        buffer->dropped = 0;
+      }
+
+      file << "\n]}\n";
+      file.close();
+
+      if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda("Saved timeline with %lu events to %s\n", n_event, path.c_str());
+      if (n_dropped > 0)
+        warningQuda("Dropped %lu timeline events after reaching QUDA_TIMELINE_MAX_EVENTS=%lu per thread", n_dropped,
+                    maxEvents());
+    }
+
+  } // namespace timeline
+
+} // namespace quda
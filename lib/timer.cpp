@@ -35,6 +35,17 @@ namespace quda {
 
   }
 
+  void TimeProfile::Record(QudaProfileType idx)
+  {
+    // the total spans the profiled function, with the other categories nested within it
+    if (idx == QUDA_PROFILE_TOTAL) {
+      timeline::record("profile", fname, profile[idx].start, profile[idx].stop);
+    } else {
+      timeline::record(idx < QUDA_PROFILE_LOWER_LEVEL ? "profile" : "api", pname[idx], profile[idx].start,
+                       profile[idx].stop, timeline::arg("profile", fname));
+    }
+  }
+
   std::string TimeProfile::pname[] = {"download",
                                       "upload",
                                       "init",
@@ -47,6 +58,7 @@ namespace quda {
                                       "chronology",
                                       "eigen",
                                       "arpack",
+                                      "host reorder",
                                       "dummy",
                                       "pack kernel",
                                       "dslash kernel",
@@ -11,12 +11,12 @@
 
 static const size_t MAX_PREFIX_SIZE = 100;
 
-static QudaVerbosity verbosity_ = QUDA_SUMMARIZE;
-static char prefix_[MAX_PREFIX_SIZE] = "";
+static QUDA_RANK_LOCAL QudaVerbosity verbosity_ = QUDA_SUMMARIZE;
+static QUDA_RANK_LOCAL char prefix_[MAX_PREFIX_SIZE] = "";
 static FILE *outfile_ = stdout;
 
 static const int MAX_BUFFER_SIZE = 1000;
-static char buffer_[MAX_BUFFER_SIZE] = "";
+static QUDA_RANK_LOCAL char buffer_[MAX_BUFFER_SIZE] = "";
 
 QudaVerbosity getVerbosity() { return verbosity_; }
 char *getOutputPrefix() { return prefix_; }
@@ -28,8 +28,8 @@ void setVerbosity(QudaVerbosity verbosity)
 }
 
 bool getRankVerbosity() {
-  static bool init = false;
-  static bool rank_verbosity = false;
+  static QUDA_RANK_LOCAL bool init = false;
+  static QUDA_RANK_LOCAL bool rank_verbosity = false;
   static char *rank_verbosity_env = getenv("QUDA_RANK_VERBOSITY");
 
   if (!init && rank_verbosity_env) { // set the policies to tune for explicitly
@@ -78,7 +78,7 @@ void setOutputFile(FILE *outfile)
 }
 
 
-static std::stack<QudaVerbosity> vstack;
+static QUDA_RANK_LOCAL std::stack<QudaVerbosity> vstack;
 
 void pushVerbosity(QudaVerbosity verbosity)
 {
@@ -100,7 +100,7 @@ void popVerbosity()
   vstack.pop();
 }
 
-static std::stack<char *> pstack;
+static QUDA_RANK_LOCAL std::stack<char *> pstack;
 
 void pushOutputPrefix(const char *prefix)
 {
@@ -15,7 +15,6 @@ namespace quda
 
   void VectorIO::load(std::vector<ColorSpinorField *> &vecs)
   {
-#ifdef HAVE_QIO
     const int Nvec = vecs.size();
     auto spinor_parity = vecs[0]->SuggestedParity();
     if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda("Start loading %04d vectors from %s\n", Nvec, filename.c_str());
@@ -49,7 +48,7 @@ namespace quda
       auto Ls = vecs[0]->Ndim() == 5 ? tmp[0]->X(4) : 1;
       auto V4 = tmp[0]->Volume() / Ls;
       auto stride = V4 * tmp[0]->Ncolor() * tmp[0]->Nspin() * 2 * tmp[0]->Precision();
-      void **V = static_cast<void **>(safe_malloc(Nvec * Ls * sizeof(void *)));
+      void **V = static_cast<void **>(pool_host_malloc(Nvec * Ls * sizeof(void *)));
       for (int i = 0; i < Nvec; i++) {
         for (int j = 0; j < Ls; j++) { V[i * Ls + j] = static_cast<char *>(tmp[i]->V()) + j * stride; }
       }
@@ -57,7 +56,7 @@ namespace quda
       read_spinor_field(filename.c_str(), &V[0], tmp[0]->Precision(), tmp[0]->X(), tmp[0]->SiteSubset(), spinor_parity,
                         tmp[0]->Ncolor(), tmp[0]->Nspin(), Nvec * Ls, 0, (char **)0);
 
-      host_free(V);
+      pool_host_free(V);
     } else {
       errorQuda("Unexpected field dimension %d", vecs[0]->Ndim());
     }
@@ -107,14 +106,10 @@ namespace quda
     }
 
     if (getVerbosity() >= QUDA_SUMMARIZE) printfQuda("Done loading vectors\n");
-#else
-    errorQuda("\nQIO library was not built.\n");
-#endif
   }
 
   void VectorIO::save(const std::vector<ColorSpinorField *> &vecs)
   {
-#ifdef HAVE_QIO
     const int Nvec = vecs.size();
     std::vector<ColorSpinorField *> tmp;
     tmp.reserve(Nvec);
@@ -185,7 +180,7 @@ namespace quda
       auto Ls = vecs[0]->Ndim() == 5 ? tmp[0]->X(4) : 1;
       auto V4 = tmp[0]->Volume() / Ls;
       auto stride = V4 * tmp[0]->Ncolor() * tmp[0]->Nspin() * 2 * tmp[0]->Precision();
-      void **V = static_cast<void **>(safe_malloc(Nvec * Ls * sizeof(void *)));
+      void **V = static_cast<void **>(pool_host_malloc(Nvec * Ls * sizeof(void *)));
       for (int i = 0; i < Nvec; i++) {
         for (int j = 0; j < Ls; j++) { V[i * Ls + j] = static_cast<char *>(tmp[i]->V()) + j * stride; }
       }
@@ -193,7 +188,7 @@ namespace quda
       write_spinor_field(filename.c_str(), &V[0], tmp[0]->Precision(), tmp[0]->X(), tmp[0]->SiteSubset(), spinor_parity,
                          tmp[0]->Ncolor(), tmp[0]->Nspin(), Nvec * Ls, 0, (char **)0);
 
-      host_free(V);
+      pool_host_free(V);
     } else {
       errorQuda("Unexpected field dimension %d", vecs[0]->Ndim());
     }
@@ -203,9 +198,6 @@ namespace quda
         || (vecs[0]->Location() == QUDA_CPU_FIELD_LOCATION && vecs[0]->SiteSubset() == QUDA_PARITY_SITE_SUBSET)) {
       for (int i = 0; i < Nvec; i++) delete tmp[i];
     }
-#else
-    errorQuda("\nQIO library was not built.\n");
-#endif
   }
 
 } // namespace quda
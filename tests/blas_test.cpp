@@ -14,6 +14,10 @@
 // google test
 #include <gtest/gtest.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace quda;
 
 /**
@@ -957,6 +961,125 @@ double test(Kernel kernel)
   return error;
 }
 
+// reductions that leave their arguments unchanged, so can be rerun on the same host fields
+bool is_cpu_threads_reduction(Kernel kernel)
+{
+  switch (kernel) {
+  case Kernel::norm2:
+  case Kernel::reDotProduct:
+  case Kernel::cDotProduct:
+  case Kernel::cDotProductNormA:
+  case Kernel::HeavyQuarkResidualNorm:
+  case Kernel::tripleCGReduction: return true;
+  default: return false;
+  }
+}
+
+/**
+   Evaluate a reduction on the host fields, returning the result as
+   (up to) three doubles.
+*/
+double3 cpu_reduce(Kernel kernel)
+{
+  switch (kernel) {
+  case Kernel::norm2: return make_double3(blas::norm2(*xH), 0.0, 0.0);
+  case Kernel::reDotProduct: return make_double3(blas::reDotProduct(*xH, *yH), 0.0, 0.0);
+  case Kernel::cDotProduct: {
+    quda::Complex dot = blas::cDotProduct(*xH, *yH);
+    return make_double3(dot.real(), dot.imag(), 0.0);
+  }
+  case Kernel::cDotProductNormA: return blas::cDotProductNormA(*xH, *yH);
+  case Kernel::HeavyQuarkResidualNorm: return blas::HeavyQuarkResidualNorm(*xH, *yH);
+  case Kernel::tripleCGReduction: return blas::tripleCGReduction(*xH, *yH, *zH);
+  default: errorQuda("Unexpected kernel %s", kernel_map.at(kernel).c_str());
+  }
+  return make_double3(0.0, 0.0, 0.0);
+}
+
+/**
+   Compare host reductions computed with a single thread against those
+   computed with all available threads.  The CPU reductions sum over
+   a fixed partitioning with a fixed-shape tree, so the two should be
+   bit-identical.  Returns the largest absolute deviation.
+*/
+double test_cpu_threads(Kernel kernel)
+{
+#ifdef _OPENMP
+  const int max_threads = omp_get_max_threads();
+  omp_set_num_threads(1);
+  double3 serial = cpu_reduce(kernel);
+  omp_set_num_threads(max_threads);
+  double3 threaded = cpu_reduce(kernel);
+  return std::max(fabs(serial.x - threaded.x), std::max(fabs(serial.y - threaded.y), fabs(serial.z - threaded.z)));
+#else
+  return fabs(cpu_reduce(kernel).x - cpu_reduce(kernel).x);
+#endif
+}
+
+bool is_cpu_block(Kernel kernel) { return (kernel == Kernel::caxpy_block || kernel == Kernel::cDotProduct_block); }
+
+/**
+   Compare the host multi-blas / multi-reduce kernels against the
+   equivalent sequence of single-vector host kernels, with the host
+   fields stored in the given precision.  Returns the average
+   relative deviation.
+*/
+double test_cpu_block(Kernel kernel, QudaPrecision prec)
+{
+  quda::Complex a(M_PI, M_PI * exp(1.0)), b(M_PI * exp(1.0), -sqrt(M_PI));
+  std::vector<quda::Complex> A(Nsrc * Msrc);
+  for (int i = 0; i < Nsrc * Msrc; i++) A[i] = a * (1.0 * i) + b * (0.5 * Nsrc * Msrc - i);
+
+  ColorSpinorParam param(*xmH[0]);
+  param.setPrecision(prec); // keep the host space-spin-color order
+  param.create = QUDA_NULL_FIELD_CREATE;
+
+  std::vector<ColorSpinorField *> x, y, y_ref;
+  for (int i = 0; i < Nsrc; i++) {
+    x.push_back(new cpuColorSpinorField(param));
+    *x[i] = *xmH[i];
+  }
+  for (int j = 0; j < Msrc; j++) {
+    y.push_back(new cpuColorSpinorField(param));
+    *y[j] = *ymH[j];
+    y_ref.push_back(new cpuColorSpinorField(param));
+    *y_ref[j] = *ymH[j];
+  }
+
+  double error = 0.0;
+  switch (kernel) {
+  case Kernel::caxpy_block:
+    blas::caxpy(A.data(), x, y);
+    for (int i = 0; i < Nsrc; i++)
+      for (int j = 0; j < Msrc; j++) blas::caxpy(A[Msrc * i + j], *x[i], *y_ref[j]);
+    for (int j = 0; j < Msrc; j++) {
+      double ref = blas::norm2(*y_ref[j]);
+      blas::axpy(-1.0, *y[j], *y_ref[j]);
+      error += sqrt(blas::norm2(*y_ref[j]) / ref);
+    }
+    error /= Msrc;
+    break;
+
+  case Kernel::cDotProduct_block:
+    blas::cDotProduct(A.data(), x, y);
+    for (int i = 0; i < Nsrc; i++) {
+      for (int j = 0; j < Msrc; j++) {
+        quda::Complex ref = blas::cDotProduct(*x[i], *y_ref[j]);
+        error += std::abs(A[i * Msrc + j] - ref) / std::abs(ref);
+      }
+    }
+    error /= Nsrc * Msrc;
+    break;
+
+  default: errorQuda("Undefined host block kernel %s\n", kernel_map.at(kernel).c_str());
+  }
+
+  for (auto &f : x) delete f;
+  for (auto &f : y) delete f;
+  for (auto &f : y_ref) delete f;
+  return error;
+}
+
 int main(int argc, char** argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
@@ -1079,6 +1202,36 @@ TEST_P(BlasTest, verify) {
   EXPECT_LE(deviation, tol) << "CPU and CUDA implementations do not agree";
 }
 
+TEST_P(BlasTest, cpu_threads)
+{
+  prec_pair_t prec_pair = ::prec_idx_map(testing::get<0>(GetParam()));
+  Kernel kernel = (Kernel)::testing::get<1>(GetParam());
+  if (skip_kernel(prec_pair, kernel)) GTEST_SKIP();
+
+  // host fields are always double precision so only check once per kernel
+  if (prec_pair.first != QUDA_DOUBLE_PRECISION || prec_pair.second != QUDA_DOUBLE_PRECISION) GTEST_SKIP();
+  if (!is_cpu_threads_reduction(kernel)) GTEST_SKIP();
+
+  double deviation = test_cpu_threads(kernel);
+  EXPECT_EQ(deviation, 0.0) << "CPU reductions depend on the number of threads";
+}
+
+TEST_P(BlasTest, cpu_block)
+{
+  prec_pair_t prec_pair = ::prec_idx_map(testing::get<0>(GetParam()));
+  Kernel kernel = (Kernel)::testing::get<1>(GetParam());
+  if (skip_kernel(prec_pair, kernel)) GTEST_SKIP();
+
+  // host fields are only double or single precision so check those uniform pairs
+  if (prec_pair.first != prec_pair.second) GTEST_SKIP();
+  if (prec_pair.first != QUDA_DOUBLE_PRECISION && prec_pair.first != QUDA_SINGLE_PRECISION) GTEST_SKIP();
+  if (!is_cpu_block(kernel)) GTEST_SKIP();
+
+  double deviation = test_cpu_block(kernel, prec_pair.first);
+  double tol = prec_pair.first == QUDA_DOUBLE_PRECISION ? 1e-12 : 1e-5;
+  EXPECT_LE(deviation, tol) << "CPU block and single-vector implementations do not agree";
+}
+
 TEST_P(BlasTest, benchmark) {
   prec_pair_t prec_pair = prec_idx_map(::testing::get<0>(GetParam()));
   Kernel kernel = (Kernel)::testing::get<1>(GetParam());
@@ -0,0 +1,173 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <vector>
+
+#include <quda_internal.h>
+#include <comm_quda.h>
+#include <util_quda.h>
+
+#include <host_utils.h>
+#include <command_line_params.h>
+
+// In a typical application, quda.h is the only QUDA header required.
+#include <quda.h>
+
+/*
+  Stress test and latency benchmark of the threaded communications
+  backend (QUDA_THREAD_COMMS=ON), in which each rank of the grid given
+  by --gridsize is a thread of this process.  Each rank exchanges
+  halos with its neighbors in every dimension, contiguous and strided,
+  and checks the collectives, for --niter iterations.
+*/
+
+// number of doubles in each halo message
+static int msg_size = 4096;
+
+/**
+   @brief The value of element i of the message sent by the given rank
+   in the given dimension and direction
+*/
+static double message(int rank, int dim, int dir, int i) { return ((rank * 4 + dim) * 2 + dir) * 1e6 + i; }
+
+static void checkHaloExchange(int iter)
+{
+  const int n = msg_size;
+  for (int dim = 0; dim < 4; dim++) {
+    // send forwards and backwards, with the backwards send strided with a stride of two elements
+    std::vector<double> send_fwd(n), send_back(2 * n), recv_fwd(n), recv_back(n);
+    for (int i = 0; i < n; i++) {
+      send_fwd[i] = message(comm_rank(), dim, 1, i + iter);
+      send_back[2 * i] = message(comm_rank(), dim, 0, i + iter);
+    }
+
+    MsgHandle *mh_recv_fwd = comm_declare_receive_relative(recv_fwd.data(), dim, +1, n * sizeof(double));
+    MsgHandle *mh_recv_back = comm_declare_receive_relative(recv_back.data(), dim, -1, n * sizeof(double));
+    MsgHandle *mh_send_fwd = comm_declare_send_relative(send_fwd.data(), dim, +1, n * sizeof(double));
+    MsgHandle *mh_send_back
+      = comm_declare_strided_send_relative(send_back.data(), dim, -1, sizeof(double), n, 2 * sizeof(double));
+
+    // alternate the order of sends and receives so that both matching paths are exercised
+    if ((iter + comm_rank()) % 2) {
+      comm_start(mh_recv_fwd);
+      comm_start(mh_recv_back);
+      comm_start(mh_send_fwd);
+      comm_start(mh_send_back);
+    } else {
+      comm_start(mh_send_back);
+      comm_start(mh_send_fwd);
+      comm_start(mh_recv_back);
+      comm_start(mh_recv_fwd);
+    }
+
+    comm_wait(mh_send_fwd);
+    comm_wait(mh_send_back);
+    comm_wait(mh_recv_fwd);
+    comm_wait(mh_recv_back);
+
+    comm_free(mh_send_fwd);
+    comm_free(mh_send_back);
+    comm_free(mh_recv_fwd);
+    comm_free(mh_recv_back);
+
+    // what arrives from the forward neighbor was sent backwards, and vice versa
+    const int fwd = comm_neighbor_rank(1, dim);
+    const int back = comm_neighbor_rank(0, dim);
+    for (int i = 0; i < n; i++) {
+      if (recv_fwd[i] != message(fwd, dim, 0, i + iter) || recv_back[i] != message(back, dim, 1, i + iter))
+        errorQuda("Halo mismatch in dim=%d at element %d: received (%e, %e) expected (%e, %e)", dim, i, recv_back[i],
+                  recv_fwd[i], message(back, dim, 1, i + iter), message(fwd, dim, 0, i + iter));
+    }
+  }
+}
+
+static void checkCollectives(int iter)
+{
+  const int rank = comm_rank();
+  const int size = comm_size();
+
+  double sum = rank + iter;
+  comm_allreduce(&sum);
+  if (sum != 0.5 * size * (size - 1) + static_cast<double>(size) * iter) errorQuda("comm_allreduce mismatch %e", sum);
+
+  double max = rank, min = rank;
+  comm_allreduce_max(&max);
+  comm_allreduce_min(&min);
+  if (max != size - 1 || min != 0) errorQuda("comm_allreduce_max/min mismatch %e %e", max, min);
+
+  int count = 1;
+  comm_allreduce_int(&count);
+  if (count != size) errorQuda("comm_allreduce_int mismatch %d", count);
+
+  uint64_t parity = 1ul << (rank % 64);
+  comm_allreduce_xor(&parity);
+  uint64_t expected = 0;
+  for (int r = 0; r < size; r++) expected ^= 1ul << (r % 64);
+  if (parity != expected) errorQuda("comm_allreduce_xor mismatch");
+
+  double array[3] = {1.0, static_cast<double>(rank), static_cast<double>(iter)};
+  ReduceHandle *rh = comm_allreduce_array_start(array, 3);
+  comm_allreduce_wait(rh);
+  if (array[0] != size || array[1] != 0.5 * size * (size - 1) || array[2] != static_cast<double>(size) * iter)
+    errorQuda("comm_allreduce_array_start mismatch");
+
+  int root_value = rank == 0 ? iter : -1;
+  comm_broadcast(&root_value, sizeof(int));
+  if (root_value != iter) errorQuda("comm_broadcast mismatch %d", root_value);
+
+  std::vector<size_t> bytes(size);
+  for (int r = 0; r < size; r++) bytes[r] = (r + 1) * sizeof(int);
+  std::vector<int> send(rank + 1, rank);
+  std::vector<int> gather(size * (size + 1) / 2);
+  comm_gather_bytes(gather.data(), bytes.data(), send.data(), send.size() * sizeof(int));
+  if (rank == 0) {
+    int offset = 0;
+    for (int r = 0; r < size; r++) {
+      for (int i = 0; i <= r; i++)
+        if (gather[offset + i] != r) errorQuda("comm_gather_bytes mismatch for rank %d", r);
+      offset += r + 1;
+    }
+  }
+}
+
+static void rankMain(void *)
+{
+  initCommsGridQuda(4, gridsize_from_cmdline.data(), nullptr, nullptr);
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < niter; i++) checkHaloExchange(i);
+  comm_barrier();
+  auto halo = std::chrono::steady_clock::now();
+  for (int i = 0; i < niter; i++) checkCollectives(i);
+  comm_barrier();
+  auto end = std::chrono::steady_clock::now();
+
+  printfQuda("%d ranks: halo exchange %e seconds per iteration, collectives %e seconds per iteration\n", comm_size(),
+             std::chrono::duration<double>(halo - start).count() / niter,
+             std::chrono::duration<double>(end - halo).count() / niter);
+  printfQuda("All checks passed\n");
+
+  comm_finalize();
+}
+
+int main(int argc, char **argv)
+{
+  auto app = make_app();
+  app->add_option("--msg-size", msg_size, "Number of doubles in each halo message (default 4096)");
+
+  try {
+    app->parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app->exit(e);
+  }
+
+  if (getenv("QUDA_TEST_GRID_SIZE")) get_gridsize_from_env(gridsize_from_cmdline.data());
+
+  int nranks = 1;
+  for (int d = 0; d < 4; d++) nranks *= gridsize_from_cmdline[d];
+  comm_threads_launch(nranks, rankMain, nullptr);
+
+  return 0;
+}
@@ -0,0 +1,127 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+
+#include <quda_internal.h>
+#include <gauge_field.h>
+#include <util_quda.h>
+
+#include <host_utils.h>
+#include <command_line_params.h>
+
+// In a typical application, quda.h is the only QUDA header required.
+#include <quda.h>
+
+using namespace quda;
+
+/*
+  Benchmark of the host extended gauge-field halo exchange, comparing
+  the reference exchange, which completes each dimension before
+  extracting the next, with the default pipelined exchange, which
+  extracts the next dimension's face while the current dimension's
+  messages are in flight.  Intended to be run with the MPI backend on
+  a single node, e.g.,
+
+    mpirun -np 4 extended_ghost_benchmark --dim 16 16 16 16 --gridsize 1 1 2 2
+
+  Set OMP_NUM_THREADS to control the number of threads used for the
+  packing and unpacking of each face.
+*/
+
+// thickness of the extended region in each dimension
+static int radius = 2;
+
+template <typename F> static double timeIt(F &&f)
+{
+  comm_barrier();
+  auto start = std::chrono::steady_clock::now();
+  f();
+  auto end = std::chrono::steady_clock::now();
+  double time = std::chrono::duration<double>(end - start).count();
+  comm_allreduce_max(&time);
+  return time;
+}
+
+static bool compareFields(const cpuGaugeField &a, const cpuGaugeField &b)
+{
+  int match = 1;
+  const size_t bytes = a.Bytes() / a.Geometry();
+  for (int d = 0; d < a.Geometry(); d++)
+    if (memcmp(static_cast<void *const *>(a.Gauge_p())[d], static_cast<void *const *>(b.Gauge_p())[d], bytes))
+      match = 0;
+  double mismatch = 1 - match;
+  comm_allreduce_max(&mismatch);
+  return mismatch == 0.0;
+}
+
+static void extendedGhostBenchmark()
+{
+  QudaGaugeParam gauge_param = newQudaGaugeParam();
+  setWilsonGaugeParam(gauge_param);
+  gauge_param.gauge_order = QUDA_QDP_GAUGE_ORDER;
+  gauge_param.ga_pad = 0;
+  setDims(gauge_param.X);
+
+  GaugeFieldParam param(0, gauge_param);
+  param.create = QUDA_NULL_FIELD_CREATE;
+  param.order = QUDA_QDP_GAUGE_ORDER;
+  cpuGaugeField U(param);
+  createSiteLinkCPU((void **)U.Gauge_p(), gauge_param.cpu_prec, 0);
+
+  // extend in every dimension, filling the non-partitioned ones locally
+  int R[4] = {radius, radius, radius, radius};
+  param.ghostExchange = QUDA_GHOST_EXCHANGE_EXTENDED;
+  param.create = QUDA_ZERO_FIELD_CREATE;
+  for (int d = 0; d < 4; d++) {
+    param.x[d] += 2 * R[d];
+    param.r[d] = R[d];
+  }
+  cpuGaugeField serial(param);
+  cpuGaugeField pipelined(param);
+  copyExtendedGauge(serial, U, QUDA_CPU_FIELD_LOCATION);
+  copyExtendedGauge(pipelined, U, QUDA_CPU_FIELD_LOCATION);
+
+  // warm up, which also checks that both variants fill the halo identically
+  serial.exchangeExtendedGhostSerial(R, true);
+  pipelined.exchangeExtendedGhost(R, true);
+  if (!compareFields(serial, pipelined)) errorQuda("Mismatch between serial and pipelined extended ghost exchange");
+
+  double serial_time = timeIt([&] {
+    for (int i = 0; i < niter; i++) serial.exchangeExtendedGhostSerial(R, true);
+  });
+  double pipelined_time = timeIt([&] {
+    for (int i = 0; i < niter; i++) pipelined.exchangeExtendedGhost(R, true);
+  });
+
+  printfQuda("Extended ghost exchange of %dx%dx%dx%d local volume, radius %d, grid %dx%dx%dx%d\n", xdim, ydim, zdim,
+             tdim, radius, comm_dim(0), comm_dim(1), comm_dim(2), comm_dim(3));
+  printfQuda("Serial exchange:    %e seconds\n", serial_time / niter);
+  printfQuda("Pipelined exchange: %e seconds (%.2fx)\n", pipelined_time / niter, serial_time / pipelined_time);
+}
+
+int main(int argc, char **argv)
+{
+  auto app = make_app();
+  app->add_option("--radius", radius, "Thickness of the extended region (default 2)");
+
+  try {
+    app->parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app->exit(e);
+  }
+
+  initComms(argc, argv, gridsize_from_cmdline);
+
+  initQuda(device);
+  setVerbosity(QUDA_SUMMARIZE);
+
+  extendedGhostBenchmark();
+
+  endQuda();
+
+  finalizeComms();
+
+  return 0;
+}
@@ -7,6 +7,8 @@
 // QUDA headers
 #include <quda.h>
 #include <color_spinor_field.h> // convenient quark field container
+#include <dirac_quda.h>
+#include <invert_quda.h>
 
 // External headers
 #include <misc.h>
@@ -97,11 +99,69 @@ void display_test_info()
              dimPartitioned(3));
 }
 
+/**
+   Solve for a null vector of the normal operator from a random
+   initial guess with a zero source, as the multigrid setup does, and
+   check that the solver converges on the relative residual rather than
+   running to the iteration limit
+*/
+bool nullVectorTest(QudaInvertParam &inv_param, const quda::ColorSpinorParam &cs_param)
+{
+  const bool pc_solve = (inv_param.solve_type == QUDA_DIRECT_PC_SOLVE || inv_param.solve_type == QUDA_NORMOP_PC_SOLVE);
+  quda::Dirac *d = nullptr;
+  quda::Dirac *dSloppy = nullptr;
+  quda::Dirac *dPre = nullptr;
+  quda::createDirac(d, dSloppy, dPre, inv_param, pc_solve);
+  quda::DiracMdagM m(*d), mSloppy(*dSloppy), mPre(*dPre);
+
+  quda::ColorSpinorParam csParam(cs_param);
+  if (pc_solve && csParam.siteSubset == QUDA_FULL_SITE_SUBSET) {
+    csParam.x[0] /= 2;
+    csParam.siteSubset = QUDA_PARITY_SITE_SUBSET;
+  } else if (!pc_solve && csParam.siteSubset == QUDA_PARITY_SITE_SUBSET) {
+    csParam.x[0] *= 2;
+    csParam.siteSubset = QUDA_FULL_SITE_SUBSET;
+  }
+  csParam.location = QUDA_CUDA_FIELD_LOCATION;
+  csParam.setPrecision(inv_param.cuda_prec, inv_param.cuda_prec, true);
+  csParam.gammaBasis = QUDA_UKQCD_GAMMA_BASIS;
+  csParam.create = QUDA_ZERO_FIELD_CREATE;
+  quda::ColorSpinorField *x = quda::ColorSpinorField::Create(csParam);
+  quda::ColorSpinorField *b = quda::ColorSpinorField::Create(csParam);
+  quda::spinorNoise(*x, 1234, QUDA_NOISE_GAUSS);
+
+  quda::SolverParam solverParam(inv_param);
+  solverParam.use_init_guess = QUDA_USE_INIT_GUESS_YES;
+  solverParam.compute_null_vector = QUDA_COMPUTE_NULL_VECTOR_YES;
+  solverParam.residual_type = QUDA_L2_RELATIVE_RESIDUAL;
+  solverParam.inv_type_precondition = QUDA_INVALID_INVERTER;
+  solverParam.deflate = false;
+
+  quda::TimeProfile profile("nullVectorTest");
+  quda::Solver *solve = quda::Solver::create(solverParam, m, mSloppy, mPre, profile);
+  (*solve)(*x, *b);
+
+  const bool converged = solverParam.iter < solverParam.maxiter;
+  printfQuda("Null-vector solve with %s: %d of at most %d iterations, %s\n", get_solver_str(solverParam.inv_type),
+             solverParam.iter, solverParam.maxiter, converged ? "converged" : "did not converge");
+
+  delete solve;
+  delete x;
+  delete b;
+  delete d;
+  delete dSloppy;
+  delete dPre;
+  return converged;
+}
+
 int main(int argc, char **argv)
 {
   setQudaDefaultMgTestParams();
   // Parse command line options
   auto app = make_app();
+  bool null_vector_test = false;
+  app->add_option("--null-vector-test", null_vector_test,
+                  "Also solve for a null vector of the normal operator and fail if it does not converge (default false)");
   add_eigen_option_group(app);
   add_deflation_option_group(app);
   add_eofa_option_group(app);
@@ -317,6 +377,52 @@ int main(int argc, char **argv)
   rng->Release();
   delete rng;
 
+  // Benchmark against a second solver, e.g., CG vs pipelined CG, on the same sequence of sources
+  if (inv_compare_type != QUDA_INVALID_INVERTER && multishift == 1) {
+    quda::ColorSpinorField *compare_in = quda::ColorSpinorField::Create(cs_param);
+    quda::ColorSpinorField *compare_out = quda::ColorSpinorField::Create(cs_param);
+    double *compare_time = new double[Nsrc];
+    double *compare_gflops = new double[Nsrc];
+
+    QudaInverterType inv_type_main = inv_param.inv_type;
+    inv_param.inv_type = inv_compare_type;
+    rng = new quda::RNG(quda::LatticeFieldParam(gauge_param), 1234);
+    rng->Init();
+
+    for (int i = 0; i < Nsrc; i++) {
+      constructRandomSpinorSource(compare_in->V(), 4, 3, inv_param.cpu_prec, gauge_param.X, *rng);
+      invertQuda(compare_out->V(), compare_in->V(), &inv_param);
+
+      compare_time[i] = inv_param.secs;
+      compare_gflops[i] = inv_param.gflops / inv_param.secs;
+      printfQuda("Done (%s): %i iter / %g secs = %g Gflops\n\n", get_solver_str(inv_compare_type), inv_param.iter,
+                 inv_param.secs, inv_param.gflops / inv_param.secs);
+    }
+
+    rng->Release();
+    delete rng;
+    inv_param.inv_type = inv_type_main;
+
+    // skip the first solve when we can, as for performanceStats
+    double total_time = 0.0, compare_total_time = 0.0;
+    for (int i = Nsrc > 1 ? 1 : 0; i < Nsrc; i++) {
+      total_time += time[i];
+      compare_total_time += compare_time[i];
+    }
+    if (Nsrc > 1) performanceStats(compare_time, compare_gflops);
+    printfQuda("Total solve time: %s %g secs, %s %g secs, speedup of %s = %g\n", get_solver_str(inv_type_main),
+               total_time, get_solver_str(inv_compare_type), compare_total_time, get_solver_str(inv_type_main),
+               compare_total_time / total_time);
+
+    delete[] compare_time;
+    delete[] compare_gflops;
+    delete compare_in;
+    delete compare_out;
+  }
+
+  int result = 0;
+  if (null_vector_test && !nullVectorTest(inv_param, cs_param)) result = 1;
+
   // free the multigrid solver
   if (inv_multigrid) destroyMultigridQuda(mg_preconditioner);
 
@@ -352,5 +458,5 @@ int main(int argc, char **argv)
   endQuda();
   finalizeComms();
 
-  return 0;
+  return result;
 }
@@ -0,0 +1,257 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <quda_internal.h>
+#include <comm_quda.h>
+#include <util_quda.h>
+#include <qio_field.h>
+
+#include <host_utils.h>
+#include <command_line_params.h>
+#include <misc.h>
+
+// google test
+#include <gtest/gtest.h>
+
+// In a typical application, quda.h is the only QUDA header required.
+#include <quda.h>
+
+/**
+   This is the lime_io_test for checking the native SciDAC LIME
+   reader and writer.  Each field type is written and read back in
+   every combination of file and field precision, and the data read
+   back are compared with those written.  When QUDA is built with QIO
+   (and QUDA_ENABLE_NATIVE_IO is not set), files written by QIO are
+   also read with the native reader and vice versa, in which case each
+   reader verifies the checksums written by the other writer.
+*/
+
+using namespace quda;
+
+static int test_argc;
+static char **test_argv;
+static std::string scratch_dir;
+
+enum FieldType { GAUGE_FIELD, FULL_SPINOR_FIELD, PARITY_SPINOR_FIELD };
+
+const char *field_names[] = {"gauge", "full_spinor", "parity_spinor"};
+
+enum class Io { native, qio };
+
+constexpr int nColor = 3;
+constexpr int nSpin = 4;
+constexpr int Nvec = 2;
+
+/**
+   Host fields as passed to the readers and writers, with per-field
+   arrays of reals in the given precision
+*/
+struct HostFields {
+  QudaPrecision prec;
+  size_t reals;
+  std::vector<std::vector<char>> data;
+  std::vector<void *> v;
+
+  HostFields(int count, size_t reals, QudaPrecision prec) : prec(prec), reals(reals), data(count), v(count)
+  {
+    for (int i = 0; i < count; i++) {
+      data[i].resize(reals * prec);
+      v[i] = data[i].data();
+    }
+  }
+
+  double get(int i, size_t j) const
+  {
+    return prec == QUDA_DOUBLE_PRECISION ? reinterpret_cast<const double *>(data[i].data())[j] :
+                                           reinterpret_cast<const float *>(data[i].data())[j];
+  }
+
+  void set(int i, size_t j, double value)
+  {
+    if (prec == QUDA_DOUBLE_PRECISION)
+      reinterpret_cast<double *>(data[i].data())[j] = value;
+    else
+      reinterpret_cast<float *>(data[i].data())[j] = value;
+  }
+};
+
+static void write_field(Io io, FieldType type, const char *filename, HostFields &field, const int *X)
+{
+  QudaSiteSubset subset = type == PARITY_SPINOR_FIELD ? QUDA_PARITY_SITE_SUBSET : QUDA_FULL_SITE_SUBSET;
+  QudaParity parity = type == PARITY_SPINOR_FIELD ? QUDA_EVEN_PARITY : QUDA_INVALID_PARITY;
+
+  if (io == Io::native) {
+    if (type == GAUGE_FIELD)
+      write_gauge_field_lime(filename, field.v.data(), field.prec, X);
+    else
+      write_spinor_field_lime(filename, field.v.data(), field.prec, X, subset, parity, nColor, nSpin, Nvec);
+  } else {
+    if (type == GAUGE_FIELD)
+      write_gauge_field(filename, field.v.data(), field.prec, X, test_argc, test_argv);
+    else
+      write_spinor_field(filename, field.v.data(), field.prec, X, subset, parity, nColor, nSpin, Nvec, test_argc,
+                         test_argv);
+  }
+}
+
+static void read_field(Io io, FieldType type, const char *filename, HostFields &field, const int *X)
+{
+  QudaSiteSubset subset = type == PARITY_SPINOR_FIELD ? QUDA_PARITY_SITE_SUBSET : QUDA_FULL_SITE_SUBSET;
+  QudaParity parity = type == PARITY_SPINOR_FIELD ? QUDA_EVEN_PARITY : QUDA_INVALID_PARITY;
+
+  if (io == Io::native) {
+    if (type == GAUGE_FIELD)
+      read_gauge_field_lime(filename, field.v.data(), field.prec, X);
+    else
+      read_spinor_field_lime(filename, field.v.data(), field.prec, X, subset, parity, nColor, nSpin, Nvec);
+  } else {
+    if (type == GAUGE_FIELD)
+      read_gauge_field(filename, field.v.data(), field.prec, X, test_argc, test_argv);
+    else
+      read_spinor_field(filename, field.v.data(), field.prec, X, subset, parity, nColor, nSpin, Nvec, test_argc,
+                        test_argv);
+  }
+}
+
+/**
+   @brief Write a random field of the given type with the writer io_out
+   in the precision file_prec, read it back with the reader io_in into a
+   field of precision field_prec, and return the number of reals that
+   differ from those written (after rounding to the field precision)
+*/
+static int round_trip(FieldType type, QudaPrecision file_prec, QudaPrecision field_prec, Io io_out, Io io_in)
+{
+  int X[4] = {xdim, ydim, zdim, tdim};
+  if (type == PARITY_SPINOR_FIELD) X[0] /= 2;
+  size_t volume = 1;
+  for (int d = 0; d < 4; d++) volume *= X[d];
+
+  const int count = type == GAUGE_FIELD ? 4 : Nvec;
+  const size_t reals = volume * (type == GAUGE_FIELD ? 18 : 2 * nSpin * nColor);
+
+  HostFields out(count, reals, file_prec);
+  std::mt19937 rng(1234 + comm_rank());
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  for (int i = 0; i < count; i++)
+    for (size_t j = 0; j < reals; j++) out.set(i, j, dist(rng));
+
+  const std::string filename = scratch_dir + "/" + field_names[type] + ".lime";
+  write_field(io_out, type, filename.c_str(), out, X);
+
+  HostFields in(count, reals, field_prec);
+  read_field(io_in, type, filename.c_str(), in, X);
+
+  int faults = 0;
+  for (int i = 0; i < count; i++) {
+    for (size_t j = 0; j < reals; j++) {
+      const double expected = field_prec == QUDA_SINGLE_PRECISION ? static_cast<float>(out.get(i, j)) : out.get(i, j);
+      if (in.get(i, j) != expected) faults++;
+    }
+  }
+  comm_allreduce_int(&faults);
+
+  comm_barrier();
+  if (comm_rank() == 0) remove(filename.c_str());
+
+  return faults;
+}
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+
+// field type, file precision, field precision
+class LimeRoundTrip : public TestWithParam<std::tuple<FieldType, QudaPrecision, QudaPrecision>>
+{
+};
+
+TEST_P(LimeRoundTrip, verify)
+{
+  FieldType type = std::get<0>(GetParam());
+  QudaPrecision file_prec = std::get<1>(GetParam());
+  QudaPrecision field_prec = std::get<2>(GetParam());
+  EXPECT_EQ(round_trip(type, file_prec, field_prec, Io::native, Io::native), 0);
+}
+
+std::string getRoundTripName(testing::TestParamInfo<std::tuple<FieldType, QudaPrecision, QudaPrecision>> param)
+{
+  std::string name = field_names[std::get<0>(param.param)];
+  name += std::string("_file_") + get_prec_str(std::get<1>(param.param));
+  name += std::string("_field_") + get_prec_str(std::get<2>(param.param));
+  return name;
+}
+
+INSTANTIATE_TEST_SUITE_P(LimeIO, LimeRoundTrip,
+                         Combine(Values(GAUGE_FIELD, FULL_SPINOR_FIELD, PARITY_SPINOR_FIELD),
+                                 Values(QUDA_DOUBLE_PRECISION, QUDA_SINGLE_PRECISION),
+                                 Values(QUDA_DOUBLE_PRECISION, QUDA_SINGLE_PRECISION)),
+                         getRoundTripName);
+
+#ifdef HAVE_QIO
+// field type, whether QIO writes (and the native reader reads) or vice versa
+class LimeQIO : public TestWithParam<std::tuple<FieldType, bool>>
+{
+};
+
+TEST_P(LimeQIO, verify)
+{
+  if (native_io_enabled()) GTEST_SKIP() << "QIO is replaced by the native reader and writer";
+  FieldType type = std::get<0>(GetParam());
+  bool qio_writes = std::get<1>(GetParam());
+  EXPECT_EQ(round_trip(type, QUDA_DOUBLE_PRECISION, QUDA_DOUBLE_PRECISION, qio_writes ? Io::qio : Io::native,
+                       qio_writes ? Io::native : Io::qio),
+            0);
+}
+
+std::string getQIOName(testing::TestParamInfo<std::tuple<FieldType, bool>> param)
+{
+  std::string name = field_names[std::get<0>(param.param)];
+  name += std::get<1>(param.param) ? "_qio_to_native" : "_native_to_qio";
+  return name;
+}
+
+INSTANTIATE_TEST_SUITE_P(LimeIO, LimeQIO,
+                         Combine(Values(GAUGE_FIELD, FULL_SPINOR_FIELD, PARITY_SPINOR_FIELD), Values(true, false)),
+                         getQIOName);
+#endif
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  int result = 0;
+
+  auto app = make_app();
+  try {
+    app->parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app->exit(e);
+  }
+
+  test_argc = argc;
+  test_argv = argv;
+  initComms(argc, argv, gridsize_from_cmdline);
+  setVerbosity(verbosity);
+
+  // rank 0 creates a scratch directory for the files, whose name is shared with the other ranks
+  char dir_template[] = "/tmp/quda_lime_io_test_XXXXXX";
+  if (comm_rank() == 0 && !mkdtemp(dir_template)) errorQuda("Unable to create a scratch directory");
+  comm_broadcast(dir_template, sizeof(dir_template));
+  scratch_dir = dir_template;
+
+  ::testing::TestEventListeners &listeners = ::testing::UnitTest::GetInstance()->listeners();
+  if (comm_rank() != 0) { delete listeners.Release(listeners.default_result_printer()); }
+  result = RUN_ALL_TESTS();
+
+  comm_barrier();
+  if (comm_rank() == 0 && rmdir(scratch_dir.c_str())) printfQuda("Unable to remove %s\n", scratch_dir.c_str());
+
+  finalizeComms();
+  return result;
+}
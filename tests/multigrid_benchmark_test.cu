@@ -1,5 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <chrono>
+#include <random>
+#include <string>
 
 #include <quda_internal.h>
 #include <color_spinor_field.h>
@@ -12,6 +15,8 @@
 // include because of nasty globals used in the tests
 #include <dslash_reference.h>
 #include <dirac_quda.h>
+#include <invert_quda.h>
+#include <transfer.h>
 
 #define MAX(a,b) ((a)>(b)?(a):(b))
 
@@ -101,7 +106,7 @@ void initFields(QudaPrecision prec)
   gParam.link_type = QUDA_COARSE_LINKS;
   gParam.t_boundary = QUDA_PERIODIC_T;
   gParam.create = QUDA_ZERO_FIELD_CREATE;
-  gParam.setPrecision(param.Precision());
+  gParam.setPrecision(QUDA_DOUBLE_PRECISION); // host links match the host spinor precision
   gParam.nDim = 4;
   gParam.siteSubset = QUDA_FULL_SITE_SUBSET;
   gParam.ghostExchange = QUDA_GHOST_EXCHANGE_PAD;
@@ -200,10 +205,156 @@ double benchmark(int test, const int niter) {
 }
 
 
+/**
+   Run the benchmark on the host fields, returning the wall-clock time
+   in seconds
+*/
+double host_benchmark(int test, const int niter)
+{
+  auto start = std::chrono::steady_clock::now();
+
+  switch (test) {
+  case 0:
+    for (int i = 0; i < niter; ++i) dirac->Dslash(xH->Even(), yH->Odd(), QUDA_EVEN_PARITY);
+    break;
+  case 1:
+    for (int i = 0; i < niter; ++i) dirac->M(*xH, *yH);
+    break;
+  case 2:
+    for (int i = 0; i < niter; ++i) dirac->Clover(xH->Even(), yH->Even(), QUDA_EVEN_PARITY);
+    break;
+  default: errorQuda("Undefined test %d", test);
+  }
+
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}
+
+/**
+   Time the host construction of the next coarser operator from the
+   host coarse links, returning the wall-clock time in seconds of a
+   single build.  With atomic set we force the fine-site parallel
+   aggregation with atomic updates, else each coarse aggregate is
+   built by a single thread.
+*/
+double host_coarse_op_benchmark(bool atomic)
+{
+  const int Nvec = Ncolor;
+
+  ColorSpinorParam param(*xH);
+  param.nDim = 4;
+  param.x[4] = 1;
+  param.create = QUDA_NULL_FIELD_CREATE;
+  std::vector<ColorSpinorField *> B(Nvec);
+  for (auto &b : B) {
+    b = new cpuColorSpinorField(param);
+    b->Source(QUDA_RANDOM_SOURCE);
+  }
+
+  int geo_bs[QUDA_MAX_DIM] = {2, 2, 2, 2};
+  TimeProfile profile("CoarseOp");
+  Transfer T(B, Nvec, 1, geo_bs, 1, QUDA_DOUBLE_PRECISION, profile);
+
+  GaugeFieldParam gParam(*Y_h);
+  for (int d = 0; d < 4; d++) gParam.x[d] = Y_h->X()[d] / geo_bs[d];
+  gParam.nColor = 2 * Nvec;
+  gParam.create = QUDA_ZERO_FIELD_CREATE;
+  cpuGaugeField Yc(gParam);
+
+  gParam.geometry = QUDA_SCALAR_GEOMETRY;
+  gParam.nFace = 0;
+  cpuGaugeField Xc(gParam);
+
+  // override the user's setting for the duration of the benchmark
+  const char *prev = getenv("QUDA_ENABLE_CPU_COARSE_ATOMIC");
+  const bool had_prev = prev != nullptr;
+  const std::string prev_value = had_prev ? prev : "";
+  setenv("QUDA_ENABLE_CPU_COARSE_ATOMIC", atomic ? "1" : "0", 1);
+
+  // do the initial tune
+  dirac->createCoarseOp(Yc, Xc, T, kappa, mass, mu);
+
+  auto start = std::chrono::steady_clock::now();
+  dirac->createCoarseOp(Yc, Xc, T, kappa, mass, mu);
+  auto end = std::chrono::steady_clock::now();
+
+  if (had_prev)
+    setenv("QUDA_ENABLE_CPU_COARSE_ATOMIC", prev_value.c_str(), 1);
+  else
+    unsetenv("QUDA_ENABLE_CPU_COARSE_ATOMIC");
+  for (auto &b : B) delete b;
+
+  return std::chrono::duration<double>(end - start).count();
+}
+
+/**
+   Fill the host coarse links with a random operator whose clover
+   term is the identity and whose hopping terms are small enough for
+   it to be diagonally dominant (for kappa = 1), so that MdagM is
+   well conditioned.  The host coarse dslash applies the true adjoint
+   for any links, so MdagM is Hermitian positive definite.
+*/
+void randomizeHostCoarseLinks()
+{
+  const int n = Y_h->Ncolor();
+  std::mt19937 rng(1234 + comm_rank());
+  std::uniform_real_distribution<double> hop(-0.6 / (8 * n), 0.6 / (8 * n));
+
+  auto Y = static_cast<double **>(Y_h->Gauge_p());
+  for (int d = 0; d < Y_h->Geometry(); d++)
+    for (size_t i = 0; i < 2 * static_cast<size_t>(Y_h->Volume()) * n * n; i++) Y[d][i] = hop(rng);
+  Y_h->exchangeGhost(QUDA_LINK_BIDIRECTIONAL);
+
+  auto X = static_cast<double **>(X_h->Gauge_p());
+  for (size_t i = 0; i < 2 * static_cast<size_t>(X_h->Volume()) * n * n; i++) X[0][i] = 0.0;
+  for (int x = 0; x < X_h->Volume(); x++)
+    for (int i = 0; i < n; i++) X[0][2 * ((static_cast<size_t>(x) * n + i) * n + i)] = 1.0;
+}
+
+/**
+   Solve MdagM x = b on the host coarse operator with the given
+   solver, returning the wall-clock time in seconds
+   @param[in] inv_type Solver to use
+   @param[out] iter Number of iterations taken
+*/
+double host_solver_benchmark(QudaInverterType inv_type, int &iter)
+{
+  QudaInvertParam inv_param = newQudaInvertParam();
+  inv_param.inv_type = inv_type;
+  inv_param.tol = tol;
+  inv_param.maxiter = niter;
+  inv_param.reliable_delta = reliable_delta;
+  inv_param.tol_hq = 0.0;
+  inv_param.cuda_prec = QUDA_DOUBLE_PRECISION;
+  inv_param.cuda_prec_sloppy = QUDA_DOUBLE_PRECISION;
+  inv_param.cuda_prec_refinement_sloppy = QUDA_DOUBLE_PRECISION;
+  inv_param.cuda_prec_precondition = QUDA_DOUBLE_PRECISION;
+  inv_param.preserve_source = QUDA_PRESERVE_SOURCE_YES;
+  inv_param.verbosity_precondition = QUDA_SILENT;
+
+  SolverParam solver_param(inv_param);
+  TimeProfile profile("HostSolver");
+  DiracMdagM mdagm(dirac);
+  Solver *solve = Solver::create(solver_param, mdagm, mdagm, mdagm, profile);
+
+  yH->Source(QUDA_RANDOM_SOURCE);
+  blas::zero(*xH);
+
+  auto start = std::chrono::steady_clock::now();
+  (*solve)(*xH, *yH);
+  auto end = std::chrono::steady_clock::now();
+
+  iter = solver_param.iter;
+  delete solve;
+  return std::chrono::duration<double>(end - start).count();
+}
+
 const char *names[] = {
   "Dslash",
   "Mat",
-  "Clover"
+  "Clover",
+  "CoarseOp",
+  "Solver"
 };
 
 int main(int argc, char** argv)
@@ -217,7 +368,7 @@ int main(int argc, char** argv)
   // add_eigen_option_group(app);
   // add_deflation_option_group(app);
   add_multigrid_option_group(app);
-  CLI::TransformPairs<int> test_type_map {{"Dslash", 0}, {"Mat", 1}, {"Clover", 2}};
+  CLI::TransformPairs<int> test_type_map {{"Dslash", 0}, {"Mat", 1}, {"Clover", 2}, {"CoarseOp", 3}, {"Solver", 4}};
   app->add_option("--test", test_type, "Test method")->transform(CLI::CheckedTransformer(test_type_map));
 
   try {
@@ -243,8 +394,37 @@ int main(int argc, char** argv)
 
     DiracParam param;
     param.halo_precision = smoother_halo_prec;
+    if (test_type == 4) param.kappa = 1.0; // the solver needs a non-trivial hopping term
     dirac = new DiracCoarse(param, Y_h, X_h, Xinv_h, Yhat_h, Y_d, X_d, Xinv_d, Yhat_d);
 
+    if (test_type == 3) {
+      // compare the host coarse-operator setup with and without atomics
+      double owner = host_coarse_op_benchmark(false);
+      double atomic = host_coarse_op_benchmark(true);
+      printfQuda("Ncolor = %2d, %-31s: aggregate-parallel = %8.3f s, atomic = %8.3f s (CPU)\n", Ncolor,
+                 names[test_type], owner, atomic);
+
+      delete dirac;
+      freeFields();
+      continue;
+    }
+
+    if (test_type == 4) {
+      // compare pipelined CG against CG on the host coarse operator, with a tuned warm-up solve for each
+      randomizeHostCoarseLinks();
+      int cg_iter, pipelined_iter;
+      host_solver_benchmark(QUDA_CG_INVERTER, cg_iter);
+      host_solver_benchmark(QUDA_PIPELINED_CG_INVERTER, pipelined_iter);
+      double cg = host_solver_benchmark(QUDA_CG_INVERTER, cg_iter);
+      double pipelined = host_solver_benchmark(QUDA_PIPELINED_CG_INVERTER, pipelined_iter);
+      printfQuda("Ncolor = %2d, %-31s: CG = %8.3f s (%d iter), pipelined CG = %8.3f s (%d iter) (CPU)\n", Ncolor,
+                 names[test_type], cg, cg_iter, pipelined, pipelined_iter);
+
+      delete dirac;
+      freeFields();
+      continue;
+    }
+
     // do the initial tune
     benchmark(test_type, 1);
 
@@ -256,6 +436,15 @@ int main(int argc, char** argv)
 
     printfQuda("Ncolor = %2d, %-31s: Gflop/s = %6.1f\n", Ncolor, names[test_type], gflops);
 
+    // repeat on the host fields to measure the CPU implementation
+    host_benchmark(test_type, 1);
+    dirac->Flops(); // reset flops counter
+
+    secs = host_benchmark(test_type, niter);
+    gflops = (dirac->Flops() * 1e-9) / (secs);
+
+    printfQuda("Ncolor = %2d, %-31s: Gflop/s = %6.1f (CPU)\n", Ncolor, names[test_type], gflops);
+
     delete dirac;
     freeFields();
   }
@@ -8,6 +8,7 @@
 
 #include <host_utils.h>
 #include <command_line_params.h>
+#include <misc.h>
 #include <dslash_reference.h>
 
 #include <color_spinor_field.h>
@@ -168,6 +169,48 @@ void packTest() {
   cpuColorSpinorField::Compare(*spinor, *spinor2, 1);
 }
 
+/**
+   Benchmark the host reordering between the space-spin-color order
+   of the application and the native device order, as used when
+   loading and saving spinor fields with the reordering on the CPU.
+*/
+void reorderBenchmark()
+{
+  QudaPrecision precs[] = {QUDA_DOUBLE_PRECISION, QUDA_SINGLE_PRECISION, QUDA_HALF_PRECISION};
+
+  for (auto native_prec : precs) {
+    ColorSpinorParam nativeParam(*cudaSpinor);
+    nativeParam.setPrecision(native_prec, native_prec, true);
+    nativeParam.create = QUDA_NULL_FIELD_CREATE;
+    cudaColorSpinorField native(nativeParam);
+
+    // host buffer in the native order that we reorder into and out of
+    char *buffer = static_cast<char *>(malloc(native.Bytes() + native.NormBytes()));
+    memset(buffer, 0, native.Bytes() + native.NormBytes());
+    char *buffer_norm = buffer + native.Bytes();
+    const double bytes = spinor->Bytes() + native.Bytes() + native.NormBytes();
+
+    copyGenericColorSpinor(native, *spinor, QUDA_CPU_FIELD_LOCATION, buffer, 0, buffer_norm, 0);
+    stopwatchStart();
+    for (int i = 0; i < niter; i++)
+      copyGenericColorSpinor(native, *spinor, QUDA_CPU_FIELD_LOCATION, buffer, 0, buffer_norm, 0);
+    double pack_time = stopwatchReadSeconds() / niter;
+
+    copyGenericColorSpinor(*spinor2, native, QUDA_CPU_FIELD_LOCATION, 0, buffer, 0, buffer_norm);
+    stopwatchStart();
+    for (int i = 0; i < niter; i++)
+      copyGenericColorSpinor(*spinor2, native, QUDA_CPU_FIELD_LOCATION, 0, buffer, 0, buffer_norm);
+    double unpack_time = stopwatchReadSeconds() / niter;
+
+    printfQuda("Host reorder %s -> %s precision native: %e seconds, %.2f GB/s\n", get_prec_str(prec_cpu),
+               get_prec_str(native_prec), pack_time, 1e-9 * bytes / pack_time);
+    printfQuda("Host reorder %s precision native -> %s: %e seconds, %.2f GB/s\n", get_prec_str(native_prec),
+               get_prec_str(prec_cpu), unpack_time, 1e-9 * bytes / unpack_time);
+
+    free(buffer);
+  }
+}
+
 int main(int argc, char **argv) {
   // command line options
   auto app = make_app();
@@ -181,6 +224,7 @@ int main(int argc, char **argv) {
 
   init();
   packTest();
+  reorderBenchmark();
   end();
 
   finalizeComms();
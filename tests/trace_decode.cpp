@@ -0,0 +1,57 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <quda_internal.h>
+#include <tune_quda.h>
+#include <util_quda.h>
+
+#include <host_utils.h>
+#include <command_line_params.h>
+
+// In a typical application, quda.h is the only QUDA header required.
+#include <quda.h>
+
+using namespace quda;
+
+/*
+  Offline utility that decodes a binary kernel trace, as streamed to
+  QUDA_RESOURCE_PATH when running with QUDA_ENABLE_TRACE set, into
+  the TSV trace format (one line per kernel launch or posted event,
+  with the tuned time and peak memory usage at that point).
+*/
+
+int main(int argc, char **argv)
+{
+  std::string input;
+  std::string output;
+
+  auto app = make_app();
+  app->add_option("--output", output, "File to write the TSV trace to (default stdout)");
+  app->add_option("input", input, "Binary trace file to decode")->required();
+
+  try {
+    app->parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app->exit(e);
+  }
+
+  initComms(argc, argv, gridsize_from_cmdline);
+
+  if (comm_rank() == 0) {
+    if (output.empty()) {
+      if (!decodeTrace(input, std::cout)) errorQuda("Unable to open trace file %s", input.c_str());
+    } else {
+      std::ofstream out(output.c_str());
+      if (!out) errorQuda("Unable to open %s for writing", output.c_str());
+      if (!decodeTrace(input, out)) errorQuda("Unable to open trace file %s", input.c_str());
+    }
+  }
+
+  finalizeComms();
+
+  return 0;
+}
@@ -0,0 +1,168 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <quda_internal.h>
+#include <tune_quda.h>
+#include <util_quda.h>
+
+#include <host_utils.h>
+#include <command_line_params.h>
+
+// In a typical application, quda.h is the only QUDA header required.
+#include <quda.h>
+
+using namespace quda;
+
+// number of synthetic tunecache entries to benchmark with
+static int n_entry = 20000;
+
+static std::string resource_dir;
+
+/**
+   @brief Generate a set of keys that resemble those found in a
+   production tunecache: a handful of volumes, long mangled kernel
+   names and aux strings that encode the various kernel variants.
+*/
+static std::vector<TuneKey> generateKeys(int n)
+{
+  const char *volumes[] = {"16x16x16x32", "24x24x24x48", "8x8x8x16", "4x4x4x8", "2x2x2x4"};
+  const char *kernels[] = {"N4quda6dslash16DslashCoarsePolicyTune", "N4quda4blas9multiBlasILb1ENS0_5caxpyEfEE",
+                           "N4quda4blas6reduceINS_5Norm2IdEE", "N4quda11WilsonCloverPreconditionedINS_12WilsonArgE",
+                           "N4quda14CopyColorSpinorILi4ELi3ENS_17FloatNOrderIsLi4ELi3ELi4EEE"};
+  std::vector<TuneKey> keys(n);
+  for (int i = 0; i < n; i++) {
+    char name[TuneKey::name_n];
+    char aux[TuneKey::aux_n];
+    snprintf(name, TuneKey::name_n, "%sILi%dELi%dEE", kernels[i % 5], i % 17, (i / 17) % 13);
+    snprintf(aux, TuneKey::aux_n, "policy_kernel=interior,commDim=%d%d%d%d,prec=%d,nSrc=%d,id=%d", (i >> 0) & 1,
+             (i >> 1) & 1, (i >> 2) & 1, (i >> 3) & 1, 2 << (i % 3), 1 + i % 8, i);
+    keys[i] = TuneKey(volumes[(i / 5) % 5], name, aux);
+  }
+  return keys;
+}
+
+static void writeSyntheticTuneCache(const std::vector<TuneKey> &keys)
+{
+  if (comm_rank() != 0) return;
+  std::ofstream file(resource_dir + "/tunecache.tsv");
+  file << "tunecache\tsynthetic\tsynthetic\tsynthetic\t# synthetic tunecache for tune_test\n" << std::endl;
+  file << "volume\tname\taux\tblock.x\tblock.y\tblock.z\tgrid.x\tgrid.y\tgrid.z\tshared_bytes\taux.x\taux.y\taux."
+          "z\taux.w\ttime\tcomment"
+       << std::endl;
+  for (size_t i = 0; i < keys.size(); i++) {
+    file << keys[i].volume << "\t" << keys[i].name << "\t" << keys[i].aux << "\t";
+    file << 32 * (1 + i % 32) << "\t1\t1\t" << 1 + i % 160 << "\t1\t1\t0\t1\t1\t1\t1\t" << 1e-6 * (1 + i % 100)
+         << "\t# synthetic entry" << std::endl;
+  }
+}
+
+static void removeResourceDir()
+{
+  DIR *dir = opendir(resource_dir.c_str());
+  if (!dir) return;
+  while (struct dirent *entry = readdir(dir)) {
+    if (!strcmp(entry->d_name, ".") || !strcmp(entry->d_name, "..")) continue;
+    remove((resource_dir + "/" + entry->d_name).c_str());
+  }
+  closedir(dir);
+  if (rmdir(resource_dir.c_str())) printfQuda("Unable to remove %s\n", resource_dir.c_str());
+}
+
+template <typename F> static double timeIt(F &&f)
+{
+  auto start = std::chrono::steady_clock::now();
+  f();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}
+
+static void tuneCacheBenchmark()
+{
+  auto keys = generateKeys(n_entry);
+  writeSyntheticTuneCache(keys);
+
+  // text cache: stringstream parsing on rank 0 followed by the broadcast
+  clearTuneCache();
+  double tsv_load = timeIt([] { loadTuneCache(); });
+  size_t tsv_entries = getTuneCache().size();
+
+  // binary cache is generated the first time the cache is saved after a text load
+  double save = timeIt([] { saveTuneCache(); });
+
+  clearTuneCache();
+  double bin_load = timeIt([] { loadTuneCache(); });
+  size_t bin_entries = getTuneCache().size();
+
+  if (tsv_entries != keys.size() || bin_entries != keys.size())
+    errorQuda("Entry count mismatch: expected %lu, text cache has %lu, binary cache has %lu", keys.size(), tsv_entries,
+              bin_entries);
+
+  printfQuda("Tunecache with %lu entries\n", keys.size());
+  printfQuda("Load text cache:   %e seconds\n", tsv_load);
+  printfQuda("Save text + binary cache: %e seconds\n", save);
+  printfQuda("Load binary cache: %e seconds (%.1fx)\n", bin_load, tsv_load / bin_load);
+
+  // lookup latency in a random order to defeat any locality in the key generation
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(1234));
+  const auto &cache = getTuneCache();
+  long long checksum = 0;
+
+  double map_time = timeIt([&] {
+    for (int i = 0; i < niter; i++)
+      for (auto &key : keys) checksum += cache.find(key)->second.block.x;
+  });
+
+  double hash_time = timeIt([&] {
+    for (int i = 0; i < niter; i++)
+      for (auto &key : keys) checksum -= findTuneParam(key)->block.x;
+  });
+
+  if (checksum != 0) errorQuda("Lookup mismatch between map and hash index (checksum = %lld)", checksum);
+
+  const double n_lookup = static_cast<double>(niter) * keys.size();
+  printfQuda("Lookup via std::map:     %.1f ns\n", 1e9 * map_time / n_lookup);
+  printfQuda("Lookup via hash index:   %.1f ns (%.1fx)\n", 1e9 * hash_time / n_lookup, map_time / hash_time);
+}
+
+int main(int argc, char **argv)
+{
+  auto app = make_app();
+  app->add_option("--nentry", n_entry, "Number of synthetic tunecache entries (default 20000)");
+
+  try {
+    app->parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app->exit(e);
+  }
+
+  initComms(argc, argv, gridsize_from_cmdline);
+
+  // use a scratch resource path so that the user's tunecache is untouched
+  char dir_template[] = "/tmp/quda_tune_test_XXXXXX";
+  if (!mkdtemp(dir_template)) errorQuda("Unable to create a scratch directory");
+  resource_dir = dir_template;
+  setenv("QUDA_RESOURCE_PATH", resource_dir.c_str(), 1);
+  setenv("QUDA_TUNE_VERSION_CHECK", "0", 1); // the synthetic text cache has no version information
+
+  initQuda(device);
+  setVerbosity(QUDA_SUMMARIZE);
+
+  tuneCacheBenchmark();
+
+  endQuda();
+  removeResourceDir();
+
+  finalizeComms();
+
+  return 0;
+}
@@ -0,0 +1,65 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <string>
+#include <vector>
+
+#include <quda_internal.h>
+#include <tune_quda.h>
+#include <util_quda.h>
+
+#include <host_utils.h>
+#include <command_line_params.h>
+
+// In a typical application, quda.h is the only QUDA header required.
+#include <quda.h>
+
+using namespace quda;
+
+/*
+  Offline utility that combines the tunecaches from several jobs into
+  one.  Each input is either a resource directory (as pointed to by
+  QUDA_RESOURCE_PATH) or a single tunecache.tsv / tunecache.bin file.
+  Where a kernel has been tuned by more than one job, the launch
+  parameters with the lowest time are kept.  The merged cache is
+  written as tunecache.tsv and tunecache.bin to the output directory,
+  which should not be in use by a running job.
+
+  Inputs are checked against the version of QUDA this utility was
+  built with; set QUDA_TUNE_VERSION_CHECK=0 to disable this.
+*/
+
+int main(int argc, char **argv)
+{
+  std::vector<std::string> inputs;
+  std::string output = ".";
+
+  auto app = make_app();
+  app->add_option("--output", output, "Directory to write the merged tunecache to (default .)");
+  app->add_option("inputs", inputs, "Resource directories or tunecache files to merge")->required();
+
+  try {
+    app->parse(argc, argv);
+  } catch (const CLI::ParseError &e) {
+    return app->exit(e);
+  }
+
+  initComms(argc, argv, gridsize_from_cmdline);
+
+  if (comm_rank() == 0) {
+    for (auto &input : inputs) {
+      size_t n_entry = getTuneCache().size();
+      if (!mergeTuneCache(input)) errorQuda("No tunecache found at %s", input.c_str());
+      printfQuda("Merged %s: %lu new entries, %lu in total\n", input.c_str(), getTuneCache().size() - n_entry,
+                 getTuneCache().size());
+    }
+
+    writeTuneCache(output);
+    printfQuda("Wrote %lu entries to %s/tunecache.tsv and %s/tunecache.bin\n", getTuneCache().size(), output.c_str(),
+               output.c_str());
+  }
+
+  finalizeComms();
+
+  return 0;
+}
@@ -55,6 +55,7 @@ quda::mgarray<int> nvec = {};
 quda::mgarray<char[256]> mg_vec_infile;
 quda::mgarray<char[256]> mg_vec_outfile;
 QudaInverterType inv_type;
+QudaInverterType inv_compare_type = QUDA_INVALID_INVERTER;
 bool inv_deflate = false;
 bool inv_multigrid = false;
 QudaInverterType precon_type = QUDA_INVALID_INVERTER;
@@ -275,7 +276,8 @@ namespace
                                                            {"ca-cg", QUDA_CA_CG_INVERTER},
                                                            {"ca-cgne", QUDA_CA_CGNE_INVERTER},
                                                            {"ca-cgnr", QUDA_CA_CGNR_INVERTER},
-                                                           {"ca-gcr", QUDA_CA_GCR_INVERTER}};
+                                                           {"ca-gcr", QUDA_CA_GCR_INVERTER},
+                                                           {"pipelined-cg", QUDA_PIPELINED_CG_INVERTER}};
 
   CLI::TransformPairs<QudaPrecision> precision_map {{"double", QUDA_DOUBLE_PRECISION},
                                                     {"single", QUDA_SINGLE_PRECISION},
@@ -402,6 +404,10 @@ std::shared_ptr<QUDAApp> make_app(std::string app_description, std::string app_n
 
   quda_app->add_option("--inv-type", inv_type, "The type of solver to use (default cg)")
     ->transform(CLI::QUDACheckedTransformer(inverter_type_map));
+  quda_app
+    ->add_option("--inv-compare-type", inv_compare_type,
+                 "Solver to benchmark against the one given by --inv-type, using the same sources (default none)")
+    ->transform(CLI::QUDACheckedTransformer(inverter_type_map));
   quda_app->add_option("--inv-deflate", inv_deflate, "Deflate the inverter using the eigensolver");
   quda_app->add_option("--inv-multigrid", inv_multigrid, "Precondition the inverter using multigrid");
   quda_app->add_option("--kappa", kappa, "Kappa of Dirac operator (default 0.12195122... [equiv to mass])");
@@ -464,10 +470,11 @@ std::shared_ptr<QUDAApp> make_app(std::string app_description, std::string app_n
   quda_app->add_option("--precon-schwarz-cycle", precon_schwarz_cycle,
                        "The number of Schwarz cycles to apply per smoother application (default=1)");
 
-  CLI::TransformPairs<int> rank_order_map {{"col", 0}, {"row", 1}};
+  CLI::TransformPairs<int> rank_order_map {{"col", 0}, {"row", 1}, {"node", 2}};
   quda_app
     ->add_option("--rank-order", rank_order,
-                 "Set the [t][z][y][x] rank order as either column major (t fastest, default) or row major (x fastest)")
+                 "Set the [t][z][y][x] rank order as either column major (t fastest, default), row major (x fastest), "
+                 "or node (blocks of ranks on the same node, chosen to minimize the inter-node halo surface; not with QMP)")
     ->transform(CLI::QUDACheckedTransformer(rank_order_map));
 
   quda_app->add_option("--recon", link_recon, "Link reconstruction type")
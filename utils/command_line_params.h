@@ -189,6 +189,7 @@ extern quda::mgarray<int> nvec;
 extern quda::mgarray<char[256]> mg_vec_infile;
 extern quda::mgarray<char[256]> mg_vec_outfile;
 extern QudaInverterType inv_type;
+extern QudaInverterType inv_compare_type;
 extern bool inv_deflate;
 extern bool inv_multigrid;
 extern QudaInverterType precon_type;
@@ -1,3 +1,4 @@
+#include <chrono>
 #include <complex>
 #include <stdlib.h>
 #include <stdio.h>
@@ -260,6 +261,9 @@ void initComms(int argc, char **argv, int *const commDims)
   QMP_thread_level_t tl;
   QMP_init_msg_passing(&argc, &argv, QMP_THREAD_SINGLE, &tl);
 
+  // QMP (and so QIO) can only be given a lexicographic topology, which would not match the node-aware map
+  if (rank_order == 2) errorQuda("The node-aware rank order is not supported with QMP");
+
   // make sure the QMP logical ordering matches QUDA's
   if (rank_order == 0) {
     int map[] = {3, 2, 1, 0};
@@ -272,6 +276,14 @@ void initComms(int argc, char **argv, int *const commDims)
   MPI_Init(&argc, &argv);
 #endif
 
+  if (rank_order == 2) {
+    // weight the halo surface of each dimension with the local lattice dimensions
+    initCommsGridQuda(4, commDims, comm_rank_from_coords_node_local, dim.data());
+    initRand();
+    printfQuda("Rank order is node-aware\n");
+    return;
+  }
+
   QudaCommsMap func = rank_order == 0 ? lex_rank_from_coords_t : lex_rank_from_coords_x;
 
   initCommsGridQuda(4, commDims, func, NULL);
@@ -1598,18 +1610,13 @@ double mom_action(void *mom, QudaPrecision prec, int len)
   return action;
 }
 
-static struct timeval startTime;
+static std::chrono::steady_clock::time_point startTime;
 
-void stopwatchStart() { gettimeofday(&startTime, NULL); }
+void stopwatchStart() { startTime = std::chrono::steady_clock::now(); }
 
 double stopwatchReadSeconds()
 {
-  struct timeval endTime;
-  gettimeofday(&endTime, NULL);
-
-  long ds = endTime.tv_sec - startTime.tv_sec;
-  long dus = endTime.tv_usec - startTime.tv_usec;
-  return ds + 0.000001*dus;
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
 }
 
 void performanceStats(double *time, double *gflops)